@@ -97,11 +97,26 @@ struct FFMODOcclusionDetails
     /** Whether or not to enable complex geometry occlusion checks. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="FMOD|Occlusion", meta=(EditCondition = "bEnableOcclusion"))
     bool bUseComplexCollisionForOcclusion;
+    /** When occlusion traces are budgeted, higher priority sources are traced more often. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FMOD|Occlusion", meta = (EditCondition = "bEnableOcclusion", ClampMin = "0"))
+    int32 OcclusionPriority;
+    /**
+     * Number of rays traced toward the listener, spread around the owner's bounds, when occlusion traces are budgeted.
+     * With more than one ray the occlusion parameter is set to the fraction of rays blocked rather than 0 or 1.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FMOD|Occlusion", meta = (EditCondition = "bEnableOcclusion", ClampMin = "1", ClampMax = "16"))
+    int32 OcclusionRayCount;
+    /** Time in seconds over which the occlusion parameter moves to a new result when occlusion traces are budgeted, or 0 to apply it at once. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FMOD|Occlusion", meta = (EditCondition = "bEnableOcclusion", ClampMin = "0"))
+    float OcclusionSmoothingTime;
 
     FFMODOcclusionDetails()
         : bEnableOcclusion(false)
         , OcclusionTraceChannel(ECC_Visibility)
         , bUseComplexCollisionForOcclusion(false)
+        , OcclusionPriority(0)
+        , OcclusionRayCount(1)
+        , OcclusionSmoothingTime(0.0f)
     {}
 };
 
@@ -128,6 +143,7 @@ class EventInstance;
 
 struct FMOD_STUDIO_TIMELINE_MARKER_PROPERTIES;
 struct FMOD_STUDIO_TIMELINE_BEAT_PROPERTIES;
+struct FFMODEventParameterInfo;
 
 /**
  * Plays FMOD Studio events.
@@ -139,6 +155,8 @@ class FMODSTUDIO_API UFMODAudioComponent : public USceneComponent
     GENERATED_UCLASS_BODY()
 
     friend struct FFMODEventControlExecutionToken;
+    friend class UFMODAudioComponentTickManager;
+    friend class UFMODOcclusionManager;
     friend FMOD_RESULT F_CALLBACK UFMODAudioComponent_EventCallback(FMOD_STUDIO_EVENT_CALLBACK_TYPE type, FMOD_STUDIO_EVENTINSTANCE *event, void *parameters);
 
 public:
@@ -279,6 +297,9 @@ public:
     /** Actual Studio instance handle. */
     FMOD::Studio::EventInstance *StudioInstance;
 
+    /** Submit 3D attributes, and the volume, attenuation and occlusion that follow from them, for the current transform. */
+    void Flush3DAttributes();
+
 // Begin UObject interface.
 #if WITH_EDITOR
     virtual void PostEditChangeProperty(FPropertyChangedEvent &e) override;
@@ -324,6 +345,21 @@ private:
     /** Apply Volume and LPF into event. */
     void ApplyVolumeLPF();
 
+    /** Set the occlusion parameter, from 0 for clear to 1 for fully occluded. */
+    void ApplyOcclusion(float Occlusion);
+
+    /** Update interior volumes, attenuation and the resulting volume and LPF after the listener moves. */
+    void UpdateEnvironment();
+
+    /** Broadcast timeline and sound stopped delegates queued by Studio callbacks. */
+    void DispatchCallbacks();
+
+    /** Hand updates over to the world's tick manager while playing, if batched ticks are enabled. */
+    void UpdateBatchedTick();
+
+    /** Take the component back from the world's tick manager. */
+    void RemoveBatchedTick();
+
     /** Timeline Marker callback. */
     void EventCallbackAddMarker(struct FMOD_STUDIO_TIMELINE_MARKER_PROPERTIES *props);
 
@@ -367,7 +403,7 @@ private:
     void ReleaseEventInstance();
 
     /** Check if a parameter is game controlled or automated to determine if it should be cached. */
-    bool ShouldCacheParameter(const FMOD_STUDIO_PARAMETER_DESCRIPTION& ParameterDescription);
+    bool ShouldCacheParameter(const FFMODEventParameterInfo &Parameter);
 
     /** Return a cached reference to the current IFMODStudioModule.*/
     IFMODStudioModule& GetStudioModule()
@@ -400,8 +436,8 @@ private:
     float LastVolume;
     /** Previously set LPF value. Used for automating volume and/or LPF with Ambient Zones. */
     float LastLPF;
-    /** Was the object occluded in the previous frame. */
-    bool wasOccluded;
+    /** Occlusion last applied to the event, from 0 for clear to 1 for fully occluded. */
+    float LastOcclusion;
     /** Stored ID of the Occlusion parameter of the Event (if applicable). */
     FMOD_STUDIO_PARAMETER_ID OcclusionID;
     /** Stored ID of the Volume parameter of the Event (if applicable). */
@@ -422,4 +458,10 @@ private:
     bool NeedDestroyProgrammerSoundCallback;
     /** The length of the current Event in milliseconds. */
     int32 EventLength;
+    /** Cached description of the current Event, set when it starts playing. */
+    TSharedPtr<const FFMODEventMetadata> EventMetadata;
+    /** Whether the transform changed since 3D attributes were last submitted. */
+    bool bPending3DAttributes;
+    /** Slot in the world's UFMODAudioComponentTickManager, or INDEX_NONE when ticking itself. */
+    int32 BatchedTickIndex;
 };
\ No newline at end of file
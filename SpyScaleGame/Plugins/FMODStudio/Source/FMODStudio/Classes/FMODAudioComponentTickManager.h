@@ -0,0 +1,60 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "fmod_studio_common.h"
+#include "FMODAudioComponentTickManager.generated.h"
+
+class UFMODAudioComponent;
+
+namespace FMOD
+{
+namespace Studio
+{
+class EventInstance;
+}
+}
+
+/**
+ * Updates every playing audio component in a game world from a single pass per frame when bBatchAudioComponentTicks
+ * is set, in place of each component's own tick function. Per component state the pass reads is kept in parallel
+ * arrays so most components are handled without touching the component itself.
+ */
+UCLASS()
+class FMODSTUDIO_API UFMODAudioComponentTickManager : public UTickableWorldSubsystem
+{
+    GENERATED_UCLASS_BODY()
+
+public:
+    /** Start or refresh batched updates for an active component. Called by UFMODAudioComponent when it plays. */
+    void AddComponent(UFMODAudioComponent *Component);
+
+    /** Stop updating a component. Called by UFMODAudioComponent when it stops playing or is unregistered. */
+    void RemoveComponent(UFMODAudioComponent *Component);
+
+    //~ USubsystem
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Deinitialize() override;
+
+    //~ FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    //~ UWorldSubsystem
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    // Components are removed before they are unregistered, so the raw pointers never outlive them
+    TArray<UFMODAudioComponent *> Components;
+    TArray<FMOD::Studio::EventInstance *> Instances;
+    /** EFMODBatchedTickFlags for each component */
+    TArray<uint8> Flags;
+    TArray<uint64> AddedFrames;
+
+    /** Scratch storage reused every tick */
+    TArray<FMOD_STUDIO_PLAYBACK_STATE> PlaybackStates;
+    TArray<TWeakObjectPtr<UFMODAudioComponent>> CallbackComponents;
+    TArray<TWeakObjectPtr<UFMODAudioComponent>> CompletedComponents;
+};
@@ -0,0 +1,78 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FMODBankManager.generated.h"
+
+class UFMODBank;
+class ULevel;
+
+namespace FMOD
+{
+namespace Studio
+{
+class Bank;
+}
+}
+
+/**
+ * Reference counts runtime bank loads for a world.
+ * Banks stay loaded while anything holds a reference, and for a grace period after the last reference is released
+ * so back to back level transitions do not reload them. The counts live in the FMOD Studio module, so references this
+ * world still holds when it is torn down are released into that grace period rather than unloaded. Banks required by
+ * streaming levels are loaded as soon as the level package has loaded, before it is made visible.
+ */
+UCLASS()
+class FMODSTUDIO_API UFMODBankManager : public UTickableWorldSubsystem
+{
+    GENERATED_UCLASS_BODY()
+
+public:
+    /** Add a reference to a bank, loading it asynchronously if it is not already loaded. */
+    UFUNCTION(BlueprintCallable, Category = "Audio|FMOD|Bank")
+    void AcquireBank(UFMODBank *Bank);
+
+    /** Remove a reference to a bank. The bank is unloaded once unreferenced for the grace period. */
+    UFUNCTION(BlueprintCallable, Category = "Audio|FMOD|Bank")
+    void ReleaseBank(UFMODBank *Bank);
+
+    /** Add a reference to each bank in the list. */
+    UFUNCTION(BlueprintCallable, Category = "Audio|FMOD|Bank")
+    void AcquireBanks(const TArray<UFMODBank *> &Banks);
+
+    /** Remove a reference from each bank in the list. */
+    UFUNCTION(BlueprintCallable, Category = "Audio|FMOD|Bank")
+    void ReleaseBanks(const TArray<UFMODBank *> &Banks);
+
+    /** Current number of references held on a bank. */
+    UFUNCTION(BlueprintPure, Category = "Audio|FMOD|Bank")
+    int32 GetBankRefCount(UFMODBank *Bank) const;
+
+    /** Whether a managed bank has finished loading. */
+    UFUNCTION(BlueprintPure, Category = "Audio|FMOD|Bank")
+    bool IsBankLoaded(UFMODBank *Bank) const;
+
+    //~ USubsystem
+    virtual void Deinitialize() override;
+
+    //~ FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    //~ UWorldSubsystem
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    void AcquireBankByGuid(const FGuid &Guid, UFMODBank *Bank);
+    void ReleaseBankByGuid(const FGuid &Guid);
+    void UpdateStreamingLevels();
+
+    /** References this world holds on each bank, released when the world is torn down */
+    TMap<FGuid, int32> HeldBanks;
+
+    /** Banks acquired on behalf of each loaded streaming level */
+    TMap<TObjectKey<ULevel>, TArray<FGuid>> LevelBanks;
+};
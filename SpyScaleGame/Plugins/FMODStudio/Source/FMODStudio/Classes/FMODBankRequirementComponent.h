@@ -0,0 +1,33 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "FMODBankRequirementComponent.generated.h"
+
+class UFMODBank;
+
+/**
+ * Declares the banks an actor or level needs.
+ * The banks are held through the world's UFMODBankManager while the actor is in play. Components placed in a
+ * streaming level also have their banks loaded as soon as the level has loaded, ahead of it becoming visible.
+ */
+UCLASS(ClassGroup = (Audio), meta = (BlueprintSpawnableComponent))
+class FMODSTUDIO_API UFMODBankRequirementComponent : public UActorComponent
+{
+    GENERATED_UCLASS_BODY()
+
+public:
+    /** Banks to keep loaded. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = FMODBanks)
+    TArray<UFMODBank *> Banks;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    /** Banks acquired in BeginPlay, released in EndPlay even if Banks was edited in between */
+    UPROPERTY(Transient)
+    TArray<UFMODBank *> AcquiredBanks;
+};
@@ -4,6 +4,7 @@
 
 #include "FMODAudioComponent.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/LatentActionManager.h"
 #include "Containers/UnrealString.h"
 #include "FMODBlueprintStatics.generated.h"
 
@@ -43,6 +44,7 @@ class FMODSTUDIO_API UFMODBlueprintStatics : public UBlueprintFunctionLibrary
     GENERATED_UCLASS_BODY()
 
     /** Plays an event.  This returns an FMOD Event Instance.  The sound does not travel with any actor.
+	 * No instance is returned when an auto played oneshot uses a pooled instance, see OneshotPoolSize.
 	 * @param Event - event to play
 	 * @param bAutoPlay - Start the event automatically.
 	 */
@@ -52,6 +54,7 @@ class FMODSTUDIO_API UFMODBlueprintStatics : public UBlueprintFunctionLibrary
     static FFMODEventInstance PlayEvent2D(UObject *WorldContextObject, UFMODEvent *Event, bool bAutoPlay);
 
     /** Plays an event at the given location. This returns an FMOD Event Instance.  The sound does not travel with any actor.
+	 * No instance is returned when an auto played oneshot uses a pooled instance, see OneshotPoolSize.
 	 * @param Event - event to play
 	 * @param Location - World position to play event at
 	 * @param bAutoPlay - Start the event automatically.
@@ -88,6 +91,13 @@ class FMODSTUDIO_API UFMODBlueprintStatics : public UBlueprintFunctionLibrary
     UFUNCTION(BlueprintCallable, Category = "Audio|FMOD")
     static UFMODEvent *FindEventByName(const FString &Name);
 
+    /** Find an event by name, loading it in the background if needed. Execution continues once the lookup completes.
+	 * @param Name - The event name
+	 * @param Event - The event found, or null if there is no event with that name
+	 */
+    UFUNCTION(BlueprintCallable, Category = "Audio|FMOD", meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+    static void FindEventByNameAsync(UObject *WorldContextObject, const FString &Name, UFMODEvent *&Event, FLatentActionInfo LatentInfo);
+
     /** Loads a bank.
 	 * @param Bank - bank to load
 	 * @param bBlocking - determines whether the bank will load synchronously
@@ -319,4 +329,14 @@ class FMODSTUDIO_API UFMODBlueprintStatics : public UBlueprintFunctionLibrary
     */
     UFUNCTION(BlueprintCallable, Category = "Audio|FMOD")
     static void SetLocale(const FString& Locale);
+
+    /** Set the active locale and swap loaded localized banks to it, keeping non-localized banks loaded.
+    */
+    UFUNCTION(BlueprintCallable, Category = "Audio|FMOD")
+    static void SwitchLocale(const FString& Locale);
+
+    /** Return true if SwitchLocale is still swapping localized banks.
+    */
+    UFUNCTION(BlueprintPure, Category = "Audio|FMOD")
+    static bool IsSwitchingLocale();
 };
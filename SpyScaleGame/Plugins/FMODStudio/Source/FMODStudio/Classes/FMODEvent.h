@@ -3,6 +3,7 @@
 #pragma once
 
 #include "FMODAsset.h"
+#include "FMODStudioModule.h"
 #include "FMODEvent.generated.h"
 
 struct FMOD_STUDIO_PARAMETER_DESCRIPTION;
@@ -20,6 +21,18 @@ public:
     void GetParameterDescriptions(TArray<FMOD_STUDIO_PARAMETER_DESCRIPTION> &Parameters) const;
 
 private:
+    friend class FFMODStudioModule;
+
+    /** An event description handle looked up by the module, valid while Generation matches the bank generation */
+    struct FCachedDescription
+    {
+        FMOD::Studio::EventDescription *Description = nullptr;
+        uint32 Generation = 0;
+    };
+
+    /** Cached event description per system context */
+    mutable FCachedDescription CachedDescriptions[EFMODSystemContext::Max];
+
     /** Get tags to show in content view */
     virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag> &OutTags) const override;
 
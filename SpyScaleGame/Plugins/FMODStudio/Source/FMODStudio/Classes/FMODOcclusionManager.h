@@ -0,0 +1,75 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
+#include "FMODOcclusionManager.generated.h"
+
+class UFMODAudioComponent;
+
+/**
+ * Traces occlusion for audio components asynchronously when bAsyncOcclusion is set. Components ask for an update
+ * whenever they would have traced synchronously, and at most OcclusionRaysPerFrame rays are traced each frame, favouring
+ * components that have waited longest, are closest to the listener and have the highest priority. Each component casts
+ * OcclusionRayCount rays and its occlusion parameter is moved toward the fraction blocked over OcclusionSmoothingTime.
+ * Results that only hit static geometry are reused until the source or listener moves by OcclusionReuseDistance.
+ */
+UCLASS()
+class FMODSTUDIO_API UFMODOcclusionManager : public UTickableWorldSubsystem
+{
+    GENERATED_UCLASS_BODY()
+
+public:
+    /** Queue an occlusion trace for a playing component. Repeated requests before the trace is issued are merged. */
+    void RequestOcclusion(UFMODAudioComponent *Component);
+
+    /** Drop any queued or in flight trace for a component. */
+    void RemoveComponent(UFMODAudioComponent *Component);
+
+    //~ USubsystem
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Deinitialize() override;
+
+    //~ FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    //~ UWorldSubsystem
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FOcclusionEntry
+    {
+        TWeakObjectPtr<UFMODAudioComponent> Component;
+
+        // Rays still in flight, and what those already read have found
+        TArray<FTraceHandle, TInlineAllocator<4>> Handles;
+        int32 RayCount = 0;
+        int32 BlockedRays = 0;
+        bool bHitMovable = false;
+
+        // Frame of the oldest request not yet traced, or 0 when none is waiting
+        uint64 RequestFrame = 0;
+
+        // Latest complete result, where it was traced from and to, and the value being smoothed toward it
+        bool bHasResult = false;
+        bool bResultReusable = false;
+        FVector TracedSource = FVector::ZeroVector;
+        FVector TracedListener = FVector::ZeroVector;
+        double TracedTime = 0.0;
+        float TargetOcclusion = 0.0f;
+        float CurrentOcclusion = 0.0f;
+    };
+
+    void CollectResults(UWorld &World);
+    void IssueTraces(UWorld &World);
+    void SmoothResults(float DeltaTime);
+
+    TMap<TObjectKey<UFMODAudioComponent>, FOcclusionEntry> Entries;
+
+    /** Scratch storage reused every tick */
+    TArray<TPair<float, FOcclusionEntry *>> Candidates;
+};
@@ -0,0 +1,66 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FMODSampleDataPreloader.generated.h"
+
+class UFMODAudioComponent;
+class UFMODEvent;
+
+namespace FMOD
+{
+namespace Studio
+{
+class EventDescription;
+}
+}
+
+/**
+ * Loads sample data for registered audio components as the nearest listener approaches them, so the first play
+ * does not wait on sample data. A component's event is preloaded once the listener is within the event's maximum
+ * distance plus SampleDataPreloadMargin, and unloaded again once the listener moves a further
+ * SampleDataPreloadHysteresis away.
+ */
+UCLASS()
+class FMODSTUDIO_API UFMODSampleDataPreloader : public UTickableWorldSubsystem
+{
+    GENERATED_UCLASS_BODY()
+
+public:
+    /** Track a component for preloading. Called by UFMODAudioComponent when it is registered. */
+    void RegisterComponent(UFMODAudioComponent *Component);
+
+    /** Stop tracking a component, unloading any sample data preloaded for it. */
+    void UnregisterComponent(UFMODAudioComponent *Component);
+
+    //~ USubsystem
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Deinitialize() override;
+
+    //~ FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    //~ UWorldSubsystem
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FPreloadEntry
+    {
+        TWeakObjectPtr<UFMODAudioComponent> Component;
+        TWeakObjectPtr<UFMODEvent> Event;
+        FMOD::Studio::EventDescription *Description = nullptr;
+
+        // Audible range of the event in Unreal units, or a negative value for 2D events
+        float MaxDistance = -1.0f;
+        bool bLoaded = false;
+    };
+
+    void RefreshEvent(FPreloadEntry &Entry, UFMODEvent *Event);
+    void Unload(FPreloadEntry &Entry);
+
+    TMap<TObjectKey<UFMODAudioComponent>, FPreloadEntry> Entries;
+};
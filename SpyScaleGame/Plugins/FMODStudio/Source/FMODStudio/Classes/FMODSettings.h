@@ -91,6 +91,18 @@ namespace EFMODPlatforms
     };
 }
 
+UENUM()
+namespace EFMODFileAccess
+{
+    enum Type
+    {
+        /** FMOD reads files through blocking callbacks serviced by the file worker threads. */
+        Synchronous,
+        /** FMOD reads are issued as prioritized async requests on Unreal async file handles. */
+        Asynchronous,
+    };
+}
+
 UENUM()
 namespace EFMODCodec
 {
@@ -198,6 +210,61 @@ struct FFMODProjectLocale
     {}
 };
 
+USTRUCT()
+struct FFMODVoiceCategory
+{
+    GENERATED_USTRUCT_BODY()
+    /**
+    * Studio path prefix of the events in this category, for example event:/SFX/Footsteps/. The longest matching prefix wins.
+    */
+    UPROPERTY(config, EditAnywhere, Category = VoiceBudget)
+    FString PathPrefix;
+    /**
+    * Maximum number of oneshot instances playing across the category, or 0 for no limit.
+    */
+    UPROPERTY(config, EditAnywhere, Category = VoiceBudget, meta = (ClampMin = "0"))
+    int32 MaxInstances;
+    /**
+    * When a limit is reached, a play can steal the oldest instance of equal or lower priority.
+    */
+    UPROPERTY(config, EditAnywhere, Category = VoiceBudget)
+    int32 Priority;
+    FFMODVoiceCategory()
+        : MaxInstances(0)
+        , Priority(0)
+    {}
+};
+
+USTRUCT()
+struct FFMODOneshotCoalesceRule
+{
+    GENERATED_USTRUCT_BODY()
+    /**
+    * Studio path of the event, or a path prefix such as event:/SFX/Impacts/ to cover several. The longest matching prefix wins.
+    */
+    UPROPERTY(config, EditAnywhere, Category = Coalescing)
+    FString PathPrefix;
+    /**
+    * Time in milliseconds after a play during which further plays nearby are merged into its instance.
+    */
+    UPROPERTY(config, EditAnywhere, Category = Coalescing, meta = (ClampMin = "0", Units = "ms"))
+    float Window;
+    /**
+    * Distance in Unreal units from the first play within which further plays are merged.
+    */
+    UPROPERTY(config, EditAnywhere, Category = Coalescing, meta = (ClampMin = "0"))
+    float Radius;
+    /**
+    * Optional event parameter set to the number of plays merged into the instance, for the event to scale its intensity with.
+    */
+    UPROPERTY(config, EditAnywhere, Category = Coalescing)
+    FString IntensityParameter;
+    FFMODOneshotCoalesceRule()
+        : Window(50.0f)
+        , Radius(200.0f)
+    {}
+};
+
 UCLASS(config = Engine, defaultconfig)
 class FMODSTUDIO_API UFMODSettings : public UObject
 {
@@ -209,6 +276,8 @@ class FMODSTUDIO_API UFMODSettings : public UObject
     friend class FFMODStudioModule;
     friend class FFMODAssetBuilder;
     friend class UFMODGenerateAssetsCommandlet;
+    friend class UFMODPackBanksCommandlet;
+    friend class FFMODBankContainerReader;
 
 public:
     /**
@@ -223,6 +292,82 @@ public:
     UPROPERTY(config, EditAnywhere, Category = Basic)
     bool bLoadAllSampleData;
 
+    /**
+     * Whether to load banks at startup without blocking the game thread.
+     * AreBanksLoaded returns false until loading finishes, then IFMODStudioModule::OnBanksLoaded is broadcast.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Basic)
+    bool bLoadBanksAsync;
+
+    /**
+     * Seconds UFMODBankManager keeps a bank loaded after its last reference is released.
+     * Avoids reloading banks shared by consecutive levels.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Basic, meta = (ClampMin = "0"))
+    float BankUnloadGracePeriod;
+
+    /**
+     * Whether to memory map bank files and let FMOD read them in place instead of copying them into its own heap.
+     * Falls back to normal file loading on platforms or packages that do not support mapped files.
+     * On Windows a mapped bank is locked while loaded, so FMOD Studio cannot overwrite it during a live bank rebuild.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Basic)
+    bool bMemoryMapBanks;
+
+    /**
+     * Event sample data budget in bytes, or 0 to disable the residency manager.
+     * Sample data is loaded when an event plays, and the least recently played events are unloaded while over budget.
+     * Only counts the events it loaded, so sample data loaded for whole banks by bLoadAllSampleData or by preloading is
+     * left alone. Each event's size is measured from its instances with Studio's memory tracking, so this requires
+     * bEnableMemoryTracking and a build that links the FMOD logging libraries.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Basic, meta = (ClampMin = "0"))
+    int64 SampleDataBudget;
+
+    /**
+     * Load sample data for audio components as the listener approaches them, so they can start without delay.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Basic)
+    bool bPreloadNearbySampleData;
+
+    /**
+     * Distance beyond an event's maximum distance at which its sample data is preloaded, in Unreal units.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Basic, meta = (ClampMin = "0", EditCondition = "bPreloadNearbySampleData"))
+    float SampleDataPreloadMargin;
+
+    /**
+     * Additional distance the listener must move away before preloaded sample data is unloaded, in Unreal units.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Basic, meta = (ClampMin = "0", EditCondition = "bPreloadNearbySampleData"))
+    float SampleDataPreloadHysteresis;
+
+    /**
+     * Maximum number of reusable instances kept for each oneshot event played with PlayEventAtLocation, or 0 to disable pooling.
+     * Pooled instances are restarted once they stop instead of being created and released for every play. Plays that use
+     * a pooled instance don't return it, since it will be reused for other plays.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Basic, meta = (ClampMin = "0"))
+    int32 OneshotPoolSize;
+
+    /**
+     * Number of instances created for a oneshot event's pool the first time it plays.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Basic, meta = (ClampMin = "0", EditCondition = "OneshotPoolSize > 0"))
+    int32 OneshotPoolPrewarmCount;
+
+    /**
+     * Seconds a pooled instance can go unused before it is released, down to OneshotPoolPrewarmCount instances per event.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Basic, meta = (ClampMin = "0", EditCondition = "OneshotPoolSize > 0"))
+    float OneshotPoolIdleTime;
+
+    /**
+     * Update playing audio components in game worlds from one batched pass per frame instead of a tick function each.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Basic)
+    bool bBatchAudioComponentTicks;
+
     /**
      * Enable live update in non-final builds.
      */
@@ -257,6 +402,72 @@ public:
     UPROPERTY(config, EditAnywhere, Category = Localization)
     TArray<FFMODProjectLocale> Locales;
 
+    /**
+     * Seconds SwitchLocale waits for events in the old localized banks to finish before stopping them.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Localization, meta = (ClampMin = "0"))
+    float LocaleSwitchTimeout;
+
+    /**
+     * Buses, such as bus:/Dialogue, that SwitchLocale also waits on before unloading the old localized banks.
+     * Use these for dialogue played through programmer sounds from localized audio tables by events in other banks.
+     * Events on these buses are stopped along with the rest once LocaleSwitchTimeout has passed.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Localization)
+    TArray<FString> LocaleSwitchWaitBuses;
+
+    /**
+     * Check event plays against the voice budget before creating an instance, including looping audio components.
+     * Plays beyond the listener's hearing range or over an instance limit are skipped, or steal an older oneshot instance.
+     */
+    UPROPERTY(config, EditAnywhere, Category = VoiceBudget)
+    bool bEnableVoiceBudget;
+
+    /**
+     * Maximum number of instances of each event playing at once, or 0 for no limit.
+     */
+    UPROPERTY(config, EditAnywhere, Category = VoiceBudget, meta = (ClampMin = "0", EditCondition = "bEnableVoiceBudget"))
+    int32 MaxInstancesPerEvent;
+
+    /**
+     * Distance beyond an event's max distance, in Unreal units, at which plays are skipped.
+     */
+    UPROPERTY(config, EditAnywhere, Category = VoiceBudget, meta = (ClampMin = "0", EditCondition = "bEnableVoiceBudget"))
+    float VoiceCullDistanceMargin;
+
+    /**
+     * Instance limits and priorities for groups of events.
+     */
+    UPROPERTY(config, EditAnywhere, Category = VoiceBudget, meta = (EditCondition = "bEnableVoiceBudget"))
+    TArray<FFMODVoiceCategory> VoiceCategories;
+
+    /**
+     * Oneshot events whose near simultaneous fire-and-forget plays at nearby locations are merged into a single instance.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Coalescing)
+    TArray<FFMODOneshotCoalesceRule> OneshotCoalesceRules;
+
+    /**
+     * Trace occlusion for audio components in game worlds asynchronously, under a per frame budget, instead of
+     * with a synchronous trace per component. Results are applied the frame after a trace is issued.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Occlusion)
+    bool bAsyncOcclusion;
+
+    /**
+     * Maximum number of occlusion traces issued each frame. Components waiting longest, closest to the listener
+     * and with the highest occlusion priority are traced first.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Occlusion, meta = (ClampMin = "1", EditCondition = "bAsyncOcclusion"))
+    int32 OcclusionRaysPerFrame;
+
+    /**
+     * Distance in Unreal units the source or listener must move before an occlusion result where every ray was blocked
+     * by static geometry is traced again, or 0 to always trace again. Results are traced again after two seconds regardless.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Occlusion, meta = (ClampMin = "0", EditCondition = "bAsyncOcclusion"))
+    float OcclusionReuseDistance;
+
     /**
      * Whether to enable vol0virtual, which means voices with low volume will automatically go virtual to save CPU.
      */
@@ -314,6 +525,26 @@ public:
     UPROPERTY(config, EditAnywhere, Category = InitSettings)
     int32 FileBufferSize;
 
+    /**
+     * How FMOD reads from disk. Asynchronous mode lets stream refills jump ahead of bank and sample data loads.
+     */
+    UPROPERTY(config, EditAnywhere, Category = InitSettings)
+    TEnumAsByte<EFMODFileAccess::Type> FileAccess;
+
+    /**
+     * Size in bytes of the read-ahead buffer kept for each file FMOD opens, or 0 to disable.
+     * Reads are served from memory while the buffer is topped up in the background. Synchronous file access only.
+     */
+    UPROPERTY(config, EditAnywhere, Category = InitSettings, meta = (ClampMin = "0"))
+    int32 FileReadAheadSize;
+
+    /**
+     * Number of worker threads servicing FMOD file requests (2 by default).
+     * Requests on different files run concurrently, so banks and streams do not wait behind each other.
+     */
+    UPROPERTY(config, EditAnywhere, Category = InitSettings, meta = (ClampMin = "1", ClampMax = "16"))
+    int32 FileThreadCount;
+
     /**
      * Studio update period in milliseconds, or 0 for default (which means 20ms).
      */
@@ -403,6 +634,13 @@ public:
     UPROPERTY(config, EditAnywhere, Category = Advanced)
     FString SkipLoadBankName;
 
+    /**
+     * Load banks from the single container written by the FMODPackBanks commandlet instead of from loose bank files.
+     * Banks missing from the container are still loaded from disk.
+     */
+    UPROPERTY(config, EditAnywhere, Category = Advanced)
+    bool bUseBankContainer;
+
     /*
     * Specify the key for loading sounds from encrypted banks.
     */
@@ -0,0 +1,63 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODAssetIndex.h"
+#include "FMODAssetLookup.h"
+#include "FMODBankLookup.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "FMODStudioPrivatePCH.h"
+
+uint64 FMODAssetIndex::HashStudioPath(const FString &StudioPath)
+{
+    FTCHARToUTF8 Utf8(*StudioPath.ToLower());
+    return CityHash64(Utf8.Get(), Utf8.Length());
+}
+
+uint64 FMODAssetIndex::HashBankFile(const FString &Path)
+{
+    TArray<uint8> Bytes;
+    if (Path.IsEmpty() || !FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+    {
+        return 0;
+    }
+    return CityHash64((const char *)Bytes.GetData(), Bytes.Num());
+}
+
+void FFMODAssetIndex::Build(const UFMODBankLookup *BankLookup, const UDataTable *AssetLookup)
+{
+    *this = FFMODAssetIndex();
+
+    if (BankLookup)
+    {
+        MasterBankPath = BankLookup->MasterBankPath;
+        MasterAssetsBankPath = BankLookup->MasterAssetsBankPath;
+        MasterStringsBankPath = BankLookup->MasterStringsBankPath;
+
+        BankLookup->DataTable->ForeachRow<FFMODLocalizedBankTable>(nullptr, [this](const FName &Key, const FFMODLocalizedBankTable &OuterRow) {
+            FFMODAssetIndexBank Bank;
+            if (!OuterRow.Banks || !FGuid::Parse(Key.ToString(), Bank.Guid))
+            {
+                return;
+            }
+
+            Bank.FirstPath = BankPaths.Num();
+            OuterRow.Banks->ForeachRow<FFMODLocalizedBankRow>(nullptr, [this](const FName &Locale, const FFMODLocalizedBankRow &InnerRow) {
+                FFMODAssetIndexBankPath &BankPath = BankPaths.AddDefaulted_GetRef();
+                BankPath.Locale = Locale.ToString();
+                BankPath.Path = InnerRow.Path;
+            });
+            Bank.PathCount = BankPaths.Num() - Bank.FirstPath;
+            Banks.Add(Bank);
+        });
+    }
+
+    if (AssetLookup)
+    {
+        AssetLookup->ForeachRow<FFMODAssetLookupRow>(nullptr, [this](const FName &Key, const FFMODAssetLookupRow &Row) {
+            FFMODAssetIndexAsset &Asset = Assets.AddDefaulted_GetRef();
+            Asset.StudioPathHash = FMODAssetIndex::HashStudioPath(Key.ToString());
+            Asset.PackageName = Row.PackageName;
+            Asset.AssetName = Row.AssetName;
+        });
+    }
+}
@@ -0,0 +1,114 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+
+class UDataTable;
+class UFMODBankLookup;
+
+/**
+ * Flat copy of the bank and asset lookup tables, written next to the banks by the asset builder so the runtime
+ * can read it in one go instead of loading the lookup packages. The index records a hash of the strings bank it was
+ * built from, so one left over from another bank build is ignored in favour of the packages.
+ */
+namespace FMODAssetIndex
+{
+    static const uint32 Magic = 0x49414D46; // 'FMAI'
+    static const uint32 Version = 2;
+
+    /** Index file name, written to and read from the platform bank directory. */
+    inline FString GetFilename() { return FString(TEXT("FMODAssetIndex.bin")); }
+
+    /** Locale of the bank path used when no path exists for the active locale. */
+    inline FString GetNonLocalizedName() { return FString(TEXT("<NON-LOCALIZED>")); }
+
+    /** Case insensitive hash of a studio path, matching the FName keys of the asset lookup. */
+    FMODSTUDIO_API uint64 HashStudioPath(const FString &StudioPath);
+
+    /** Hash of a bank file's contents, or 0 if it can't be read. */
+    FMODSTUDIO_API uint64 HashBankFile(const FString &Path);
+}
+
+/** A bank and the range of its per-locale paths in FFMODAssetIndex::BankPaths. */
+struct FFMODAssetIndexBank
+{
+    FGuid Guid;
+    int32 FirstPath = 0;
+    int32 PathCount = 0;
+
+    friend FArchive &operator<<(FArchive &Ar, FFMODAssetIndexBank &Bank)
+    {
+        Ar << Bank.Guid;
+        Ar << Bank.FirstPath;
+        Ar << Bank.PathCount;
+        return Ar;
+    }
+};
+
+struct FFMODAssetIndexBankPath
+{
+    /** Locale code, or FMODAssetIndex::GetNonLocalizedName() */
+    FString Locale;
+
+    /** Bank path relative to the platform bank directory */
+    FString Path;
+
+    friend FArchive &operator<<(FArchive &Ar, FFMODAssetIndexBankPath &BankPath)
+    {
+        Ar << BankPath.Locale;
+        Ar << BankPath.Path;
+        return Ar;
+    }
+};
+
+struct FFMODAssetIndexAsset
+{
+    uint64 StudioPathHash = 0;
+    FString PackageName;
+    FString AssetName;
+
+    friend FArchive &operator<<(FArchive &Ar, FFMODAssetIndexAsset &Asset)
+    {
+        Ar << Asset.StudioPathHash;
+        Ar << Asset.PackageName;
+        Ar << Asset.AssetName;
+        return Ar;
+    }
+};
+
+struct FFMODAssetIndex
+{
+    uint32 Magic = FMODAssetIndex::Magic;
+    uint32 Version = FMODAssetIndex::Version;
+
+    /** HashBankFile of the master strings bank the lookups were built from */
+    uint64 StringsBankHash = 0;
+    FString MasterBankPath;
+    FString MasterAssetsBankPath;
+    FString MasterStringsBankPath;
+    TArray<FFMODAssetIndexBank> Banks;
+    TArray<FFMODAssetIndexBankPath> BankPaths;
+    TArray<FFMODAssetIndexAsset> Assets;
+
+    /** Fill the index from the lookup tables. Either table may be null. */
+    FMODSTUDIO_API void Build(const UFMODBankLookup *BankLookup, const UDataTable *AssetLookup);
+
+    friend FArchive &operator<<(FArchive &Ar, FFMODAssetIndex &Index)
+    {
+        Ar << Index.Magic;
+        Ar << Index.Version;
+        if (Index.Magic == FMODAssetIndex::Magic && Index.Version == FMODAssetIndex::Version)
+        {
+            Ar << Index.StringsBankHash;
+            Ar << Index.MasterBankPath;
+            Ar << Index.MasterAssetsBankPath;
+            Ar << Index.MasterStringsBankPath;
+            Ar << Index.Banks;
+            Ar << Index.BankPaths;
+            Ar << Index.Assets;
+        }
+        return Ar;
+    }
+};
@@ -16,32 +16,72 @@
 #include "FMODStudioPrivatePCH.h"
 #include "fmod_studio.hpp"
 #include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
 #include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
 
 FFMODAssetTable::FFMODAssetTable()
     : ActiveLocale(FString()),
-      BankLookup(nullptr),
-      AssetLookup(nullptr)
+      bLoaded(false)
 {
 }
 
-void FFMODAssetTable::AddReferencedObjects(FReferenceCollector& Collector)
+void FFMODAssetTable::Load()
 {
-    // The garbage collector will clean up any objects which aren't referenced, doing this tells the garbage collector our lookups are referenced
-    // (the GC knows not to remove objects referenced by a UPROPERTY, doing this manually is required because our members aren't UPROPERTYs)
-    if (BankLookup)
+    bLoaded = LoadIndexFile();
+
+    if (!bLoaded)
     {
-        Collector.AddReferencedObject(BankLookup);
+        LoadLookupPackages();
     }
 
-    if (AssetLookup)
+    BuildResolvedBankPaths();
+
+    AssetsByStudioPath.Reset();
+    ResolvedAssets.Reset();
+    for (int32 i = 0; i < Index.Assets.Num(); ++i)
     {
-        Collector.AddReferencedObject(AssetLookup);
+        AssetsByStudioPath.Add(Index.Assets[i].StudioPathHash, i);
     }
 }
 
-void FFMODAssetTable::Load()
+bool FFMODAssetTable::LoadIndexFile()
+{
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    FString IndexPath = Settings.GetFullBankPath() / FMODAssetIndex::GetFilename();
+
+    TArray<uint8> Bytes;
+    if (!IFileManager::Get().FileExists(*IndexPath) || !FFileHelper::LoadFileToArray(Bytes, *IndexPath))
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(Bytes);
+    Reader << Index;
+
+    if (Reader.IsError() || Index.Magic != FMODAssetIndex::Magic || Index.Version != FMODAssetIndex::Version)
+    {
+        UE_LOG(LogFMOD, Warning, TEXT("Ignoring out of date asset index %s"), *IndexPath);
+        Index = FFMODAssetIndex();
+        return false;
+    }
+
+    // An index that wasn't rebuilt along with the banks would resolve the wrong banks and assets
+    const uint64 StringsBankHash = FMODAssetIndex::HashBankFile(Settings.GetFullBankPath() / Index.MasterStringsBankPath);
+    if (Index.StringsBankHash == 0 || Index.StringsBankHash != StringsBankHash)
+    {
+        UE_LOG(LogFMOD, Warning, TEXT("Ignoring asset index %s, it was built from a different strings bank"), *IndexPath);
+        Index = FFMODAssetIndex();
+        return false;
+    }
+
+    UE_LOG(LogFMOD, Display, TEXT("Loaded asset index (%d banks, %d assets)"), Index.Banks.Num(), Index.Assets.Num());
+    return true;
+}
+
+void FFMODAssetTable::LoadLookupPackages()
 {
     const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
     FString PackagePath = Settings.GetFullContentPath() / PrivateDataPath();
@@ -49,7 +89,7 @@ void FFMODAssetTable::Load()
     FString PackageName = PackagePath + BankLookupName();
     UPackage *Package = CreatePackage(*PackageName);
     Package->FullyLoad();
-    BankLookup = FindObject<UFMODBankLookup>(Package, *BankLookupName(), true);
+    UFMODBankLookup *BankLookup = FindObject<UFMODBankLookup>(Package, *BankLookupName(), true);
 
     if (BankLookup)
     {
@@ -73,7 +113,7 @@ void FFMODAssetTable::Load()
     PackageName = PackagePath + AssetLookupName();
     Package = CreatePackage(*PackageName);
     Package->FullyLoad();
-    AssetLookup = FindObject<UDataTable>(Package, *AssetLookupName(), true);
+    UDataTable *AssetLookup = FindObject<UDataTable>(Package, *AssetLookupName(), true);
 
     if (AssetLookup)
     {
@@ -93,81 +133,98 @@ void FFMODAssetTable::Load()
             UE_LOG(LogFMOD, Error, TEXT("Failed to load asset lookup"));
         }
     }
+
+    // Copy the tables so lookups work the same whichever way they were loaded
+    Index.Build(BankLookup, AssetLookup);
+    bLoaded = (BankLookup != nullptr);
 }
 
-FString FFMODAssetTable::GetBankPathByGuid(const FGuid& Guid) const
+void FFMODAssetTable::BuildResolvedBankPaths()
 {
-    FString BankPath;
+    ResolvedBankPaths.Reset();
 
-    if (!BankLookup)
+    if (!bLoaded)
     {
-        UE_LOG(LogFMOD, Error, TEXT("Bank lookup not loaded"));
-        return BankPath;
+        return;
     }
 
-    FString GUID = Guid.ToString(EGuidFormats::DigitsWithHyphensInBraces);
-    FName BankTableName(*GUID);
-    FFMODLocalizedBankTable *BankTable = BankLookup->DataTable->FindRow<FFMODLocalizedBankTable>(BankTableName, nullptr, false);
+    const FString BankDir = GetDefault<UFMODSettings>()->GetFullBankPath();
+    ResolvedBankPaths.Reserve(Index.Banks.Num());
 
-    if (BankTable)
+    for (const FFMODAssetIndexBank &Bank : Index.Banks)
     {
-        BankPath = GetLocalizedBankPath(BankTable->Banks);
+        FString BankPath = GetLocalizedBankPath(Bank);
+
+        if (!BankPath.IsEmpty())
+        {
+            ResolvedBankPaths.Add(Bank.Guid, BankDir / BankPath);
+        }
     }
-    
-    return BankPath;
 }
 
-FString FFMODAssetTable::GetLocalizedBankPath(const UDataTable* BankTable) const
+FString FFMODAssetTable::GetLocalizedBankPath(const FFMODAssetIndexBank &Bank) const
 {
-    FName RowName(*ActiveLocale);
-    FFMODLocalizedBankRow *Row = BankTable->FindRow<FFMODLocalizedBankRow>(RowName, nullptr, false);
-
-    if (!Row)
-    {
-        RowName = FName("<NON-LOCALIZED>");
-        Row = BankTable->FindRow<FFMODLocalizedBankRow>(RowName, nullptr, false);
-    }
+    return GetLocalizedBankPath(Bank, ActiveLocale);
+}
 
-    FString BankPath;
+FString FFMODAssetTable::GetLocalizedBankPath(const FFMODAssetIndexBank &Bank, const FString &LocaleCode) const
+{
+    const FFMODAssetIndexBankPath *NonLocalized = nullptr;
 
-    if (Row)
+    for (int32 i = Bank.FirstPath; i < Bank.FirstPath + Bank.PathCount; ++i)
     {
-        BankPath = Row->Path;
+        const FFMODAssetIndexBankPath &Row = Index.BankPaths[i];
+        if (Row.Locale == LocaleCode)
+        {
+            return Row.Path;
+        }
+        if (Row.Locale == FMODAssetIndex::GetNonLocalizedName())
+        {
+            NonLocalized = &Row;
+        }
     }
 
-    return BankPath;
+    return NonLocalized ? NonLocalized->Path : FString();
 }
 
 FString FFMODAssetTable::GetBankPath(const UFMODBank &Bank) const
 {
-    FString BankPath = GetBankPathByGuid(Bank.AssetGuid);
+    if (!bLoaded)
+    {
+        UE_LOG(LogFMOD, Error, TEXT("Bank lookup not loaded"));
+        return FString();
+    }
+
+    const FString *BankPath = ResolvedBankPaths.Find(Bank.AssetGuid);
 
-    if (BankPath.IsEmpty())
+    if (!BankPath)
     {
         UE_LOG(LogFMOD, Warning, TEXT("Could not find disk file for bank %s"), *Bank.GetName());
+        return FString();
     }
 
-    return BankPath;
+    return *BankPath;
 }
 
 FString FFMODAssetTable::GetMasterBankPath() const
 {
-    return BankLookup ? BankLookup->MasterBankPath : FString();
+    return Index.MasterBankPath;
 }
 
 FString FFMODAssetTable::GetMasterStringsBankPath() const
 {
-    return BankLookup ? BankLookup->MasterStringsBankPath : FString();
+    return Index.MasterStringsBankPath;
 }
 
 FString FFMODAssetTable::GetMasterAssetsBankPath() const
 {
-    return BankLookup ? BankLookup->MasterAssetsBankPath : FString();
+    return Index.MasterAssetsBankPath;
 }
 
 void FFMODAssetTable::SetLocale(const FString &LocaleCode)
 {
     ActiveLocale = LocaleCode;
+    BuildResolvedBankPaths();
 }
 
 FString FFMODAssetTable::GetLocale() const
@@ -177,18 +234,19 @@ FString FFMODAssetTable::GetLocale() const
 
 void FFMODAssetTable::GetAllBankPaths(TArray<FString> &Paths, bool IncludeMasterBank) const
 {
-    if (BankLookup)
+    if (bLoaded)
     {
         const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
 
-        BankLookup->DataTable->ForeachRow<FFMODLocalizedBankTable>(nullptr, [this, &Paths, IncludeMasterBank, &Settings](const FName &, const FFMODLocalizedBankTable& OuterRow) {
-            FString BankPath = GetLocalizedBankPath(OuterRow.Banks);
+        for (const FFMODAssetIndexBank &Bank : Index.Banks)
+        {
+            FString BankPath = GetLocalizedBankPath(Bank);
             bool Skip = false;
 
             if (BankPath.IsEmpty())
             {
                 // Never expect to be in here, but should skip empty paths
-                return;
+                continue;
             }
 
             if (!IncludeMasterBank)
@@ -200,7 +258,34 @@ void FFMODAssetTable::GetAllBankPaths(TArray<FString> &Paths, bool IncludeMaster
             {
                 Paths.Push(Settings.GetFullBankPath() / BankPath);
             }
-        });
+        }
+    }
+    else
+    {
+        UE_LOG(LogFMOD, Error, TEXT("Bank lookup not loaded"));
+    }
+}
+
+void FFMODAssetTable::GetLocalizedBankChanges(const FString &OldLocaleCode, const FString &NewLocaleCode, TArray<FFMODLocalizedBankChange> &Changes) const
+{
+    if (bLoaded)
+    {
+        const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+
+        for (const FFMODAssetIndexBank &Bank : Index.Banks)
+        {
+            // Non-localized banks resolve to the <NON-LOCALIZED> row for both locales
+            FString OldPath = GetLocalizedBankPath(Bank, OldLocaleCode);
+            FString NewPath = GetLocalizedBankPath(Bank, NewLocaleCode);
+
+            if (OldPath != NewPath)
+            {
+                FFMODLocalizedBankChange &Change = Changes.AddDefaulted_GetRef();
+                Change.Guid = Bank.Guid;
+                Change.OldPath = OldPath.IsEmpty() ? OldPath : Settings.GetFullBankPath() / OldPath;
+                Change.NewPath = NewPath.IsEmpty() ? NewPath : Settings.GetFullBankPath() / NewPath;
+            }
+        }
     }
     else
     {
@@ -208,22 +293,103 @@ void FFMODAssetTable::GetAllBankPaths(TArray<FString> &Paths, bool IncludeMaster
     }
 }
 
+UFMODAsset *FFMODAssetTable::FindResolvedAsset(uint64 StudioPathHash) const
+{
+    const TWeakObjectPtr<UFMODAsset> *Resolved = ResolvedAssets.Find(StudioPathHash);
+
+    if (Resolved)
+    {
+        if (UFMODAsset *Asset = Resolved->Get())
+        {
+            return Asset;
+        }
+
+        // The asset has been garbage collected since it was resolved
+        ResolvedAssets.Remove(StudioPathHash);
+    }
+
+    return nullptr;
+}
+
 UFMODAsset *FFMODAssetTable::GetAssetByStudioPath(const FString &InStudioPath) const
 {
-    UFMODAsset *Asset = nullptr;
+    const uint64 Hash = FMODAssetIndex::HashStudioPath(InStudioPath);
+    UFMODAsset *Asset = FindResolvedAsset(Hash);
 
-    if (AssetLookup)
+    if (Asset)
+    {
+        return Asset;
+    }
+
+    const int32 *AssetIndex = AssetsByStudioPath.Find(Hash);
+
+    if (AssetIndex)
     {
-        FFMODAssetLookupRow *Row = AssetLookup->FindRow<FFMODAssetLookupRow>(FName(*InStudioPath), nullptr);
+        const FFMODAssetIndexAsset &Row = Index.Assets[*AssetIndex];
+
+        // Only pay for a load if the package isn't already in memory
+        UPackage *Package = FindPackage(nullptr, *(Row.PackageName));
+        Asset = Package ? FindObject<UFMODAsset>(Package, *(Row.AssetName)) : nullptr;
 
-        if (Row)
+        if (!Asset)
         {
-            UPackage *Package = CreatePackage(*(Row->PackageName));
+            Package = CreatePackage(*(Row.PackageName));
             Package->FullyLoad();
-            Asset = FindObject<UFMODAsset>(Package, *(Row->AssetName));
+            Asset = FindObject<UFMODAsset>(Package, *(Row.AssetName));
         }
 
+        if (Asset)
+        {
+            ResolvedAssets.Add(Hash, Asset);
+        }
     }
 
     return Asset;
 }
+
+void FFMODAssetTable::GetAssetByStudioPathAsync(const FString &InStudioPath, TFunction<void(UFMODAsset *)> &&OnResolved) const
+{
+    const uint64 Hash = FMODAssetIndex::HashStudioPath(InStudioPath);
+    UFMODAsset *Asset = FindResolvedAsset(Hash);
+    const int32 *AssetIndex = Asset ? nullptr : AssetsByStudioPath.Find(Hash);
+
+    if (!AssetIndex)
+    {
+        OnResolved(Asset);
+        return;
+    }
+
+    const FFMODAssetIndexAsset &Row = Index.Assets[*AssetIndex];
+    UPackage *Package = FindPackage(nullptr, *(Row.PackageName));
+    Asset = Package ? FindObject<UFMODAsset>(Package, *(Row.AssetName)) : nullptr;
+
+    if (Asset)
+    {
+        ResolvedAssets.Add(Hash, Asset);
+        OnResolved(Asset);
+        return;
+    }
+
+    FString AssetName = Row.AssetName;
+    LoadPackageAsync(Row.PackageName,
+        FLoadPackageAsyncDelegate::CreateLambda([this, Hash, AssetName, OnResolved = MoveTemp(OnResolved)](
+            const FName &PackageName, UPackage *LoadedPackage, EAsyncLoadingResult::Type Result) {
+            UFMODAsset *LoadedAsset = nullptr;
+
+            if (Result == EAsyncLoadingResult::Succeeded && LoadedPackage)
+            {
+                LoadedAsset = FindObject<UFMODAsset>(LoadedPackage, *AssetName);
+            }
+
+            if (LoadedAsset)
+            {
+                ResolvedAssets.Add(Hash, LoadedAsset);
+            }
+            else
+            {
+                UE_LOG(LogFMOD, Warning, TEXT("Failed to load asset %s from package %s"), *AssetName, *PackageName.ToString());
+            }
+
+            OnResolved(LoadedAsset);
+        }));
+}
@@ -2,27 +2,27 @@
 
 #pragma once
 
-#include "UObject/GCObject.h"
+#include "FMODAssetIndex.h"
 
-class UDataTable;
 class UFMODAsset;
 class UFMODBank;
-class UFMODBankLookup;
 
-class FFMODAssetTable : public FGCObject
+/** A localized bank whose file differs between two locales */
+struct FFMODLocalizedBankChange
+{
+    FGuid Guid;
+    FString OldPath;
+    FString NewPath;
+};
+
+class FFMODAssetTable
 {
 public:
     FFMODAssetTable();
 
-    //~ FGCObject
-    void AddReferencedObjects(FReferenceCollector& Collector) override;
-    virtual FString GetReferencerName() const override
-    {
-        return TEXT("FFMODAssetTable");
-    }
-
     void Load();
 
+    /** Full disk path of a bank for the active locale, or an empty string if it is unknown */
     FString GetBankPath(const UFMODBank &Bank) const;
     FString GetMasterBankPath() const;
     FString GetMasterStringsBankPath() const;
@@ -31,17 +31,36 @@ public:
     FString GetLocale() const;
     void GetAllBankPaths(TArray<FString> &BankPaths, bool IncludeMasterBank) const;
 
+    /** Find the banks whose file changes when switching between two locales. Paths are full paths. */
+    void GetLocalizedBankChanges(const FString &OldLocaleCode, const FString &NewLocaleCode, TArray<FFMODLocalizedBankChange> &Changes) const;
+
     UFMODAsset *GetAssetByStudioPath(const FString &InStudioPath) const;
 
+    /** Resolve a studio path without blocking the game thread. OnResolved is called immediately if the asset is already loaded. */
+    void GetAssetByStudioPathAsync(const FString &InStudioPath, TFunction<void(UFMODAsset *)> &&OnResolved) const;
+
     static inline FString PrivateDataPath() { return FString(TEXT("PrivateIntegrationData/")); }
     static inline FString BankLookupName()  { return FString(TEXT("BankLookup")); }
     static inline FString AssetLookupName() { return FString(TEXT("AssetLookup")); }
 
 private:
-    FString GetBankPathByGuid(const FGuid& Guid) const;
-    FString GetLocalizedBankPath(const UDataTable* BankTable) const;
+    bool LoadIndexFile();
+    void LoadLookupPackages();
+
+    void BuildResolvedBankPaths();
+    FString GetLocalizedBankPath(const FFMODAssetIndexBank &Bank) const;
+    FString GetLocalizedBankPath(const FFMODAssetIndexBank &Bank, const FString &LocaleCode) const;
+    UFMODAsset *FindResolvedAsset(uint64 StudioPathHash) const;
 
     FString ActiveLocale;
-    UFMODBankLookup *BankLookup;
-    UDataTable *AssetLookup;
+    bool bLoaded;
+    FFMODAssetIndex Index;
+
+    /** Full bank paths for the active locale, rebuilt whenever the index or locale changes */
+    TMap<FGuid, FString> ResolvedBankPaths;
+
+    TMap<uint64, int32> AssetsByStudioPath;
+
+    /** Assets already resolved by studio path hash. Weak so the cache never keeps an asset alive. */
+    mutable TMap<uint64, TWeakObjectPtr<UFMODAsset>> ResolvedAssets;
 };
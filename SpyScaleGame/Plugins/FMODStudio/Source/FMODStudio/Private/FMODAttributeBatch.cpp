@@ -0,0 +1,50 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODAttributeBatch.h"
+#include "FMODAudioComponent.h"
+#include "FMODStudioPrivatePCH.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD 3D Attributes - Submitted"), STAT_FMOD_3DAttributes_Submitted, STATGROUP_FMOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD 3D Attributes - Coalesced"), STAT_FMOD_3DAttributes_Coalesced, STATGROUP_FMOD);
+DECLARE_CYCLE_STAT(TEXT("FMOD 3D Attributes - Flush"), STAT_FMOD_3DAttributes_Flush, STATGROUP_FMOD);
+
+// Game thread only, the clock sinks tick on the game thread. Two lists are swapped so neither reallocates each frame.
+static TArray<TWeakObjectPtr<UFMODAudioComponent>> gQueued3DAttributes;
+static TArray<TWeakObjectPtr<UFMODAudioComponent>> gFlushing3DAttributes;
+
+void QueueFMOD3DAttributes(UFMODAudioComponent *Component, bool bAlreadyQueued)
+{
+    check(IsInGameThread());
+
+    if (bAlreadyQueued)
+    {
+        INC_DWORD_STAT(STAT_FMOD_3DAttributes_Coalesced);
+        return;
+    }
+
+    gQueued3DAttributes.Add(Component);
+}
+
+void FlushFMOD3DAttributes()
+{
+    if (gQueued3DAttributes.Num() == 0)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_FMOD_3DAttributes_Flush);
+
+    // Flushing can queue again, for example if a component moves itself in response
+    Exchange(gQueued3DAttributes, gFlushing3DAttributes);
+
+    for (const TWeakObjectPtr<UFMODAudioComponent> &Component : gFlushing3DAttributes)
+    {
+        if (UFMODAudioComponent *AudioComponent = Component.Get())
+        {
+            AudioComponent->Flush3DAttributes();
+            INC_DWORD_STAT(STAT_FMOD_3DAttributes_Submitted);
+        }
+    }
+
+    gFlushing3DAttributes.Reset();
+}
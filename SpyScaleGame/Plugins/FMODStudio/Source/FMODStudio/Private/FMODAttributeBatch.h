@@ -0,0 +1,16 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UFMODAudioComponent;
+
+/**
+ * Queue a playing component so its 3D attributes are submitted once, just before the next Studio update.
+ * bAlreadyQueued counts the call as coalesced into the update that is already queued.
+ */
+void QueueFMOD3DAttributes(UFMODAudioComponent *Component, bool bAlreadyQueued);
+
+/** Submit the attributes of every queued component. Called by the system clock sinks before updating. */
+void FlushFMOD3DAttributes();
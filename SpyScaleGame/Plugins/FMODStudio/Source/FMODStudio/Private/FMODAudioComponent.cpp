@@ -4,8 +4,13 @@
 #include "FMODStudioModule.h"
 #include "FMODUtils.h"
 #include "FMODEvent.h"
+#include "FMODEventMetadata.h"
+#include "FMODAttributeBatch.h"
 #include "FMODListener.h"
 #include "FMODSettings.h"
+#include "FMODSampleDataPreloader.h"
+#include "FMODAudioComponentTickManager.h"
+#include "FMODOcclusionManager.h"
 #include "fmod_studio.hpp"
 #include "Misc/App.h"
 #include "Misc/Paths.h"
@@ -36,13 +41,15 @@ UFMODAudioComponent::UFMODAudioComponent(const FObjectInitializer &ObjectInitial
     , AmbientLPF(0.0f)
     , LastVolume(1.0f)
     , LastLPF(MAX_FILTER_FREQUENCY)
-    , wasOccluded(false)
+    , LastOcclusion(0.0f)
     , OcclusionID()
     , AmbientVolumeID()
     , AmbientLPFID()
     , ProgrammerSound(nullptr)
     , NeedDestroyProgrammerSoundCallback(false)
     , EventLength(0)
+    , bPending3DAttributes(false)
+    , BatchedTickIndex(INDEX_NONE)
 {
     bAutoActivate = true;
     bNeverNeedsRenderUpdate = true;
@@ -93,6 +100,14 @@ void UFMODAudioComponent::OnRegister()
     UpdateSpriteTexture();
 #endif
 
+    if (UWorld *World = GetWorld())
+    {
+        if (UFMODSampleDataPreloader *Preloader = World->GetSubsystem<UFMODSampleDataPreloader>())
+        {
+            Preloader->RegisterComponent(this);
+        }
+    }
+
     if (IsActive() && bAutoActivate)
     {
         FMOD_STUDIO_PLAYBACK_STATE state = FMOD_STUDIO_PLAYBACK_STOPPED;
@@ -155,6 +170,17 @@ void UFMODAudioComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransfor
 {
     Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
     if (StudioInstance)
+    {
+        // Submitted once before the next Studio update, however many times the transform changes before then
+        QueueFMOD3DAttributes(this, bPending3DAttributes);
+        bPending3DAttributes = true;
+    }
+}
+
+void UFMODAudioComponent::Flush3DAttributes()
+{
+    bPending3DAttributes = false;
+    if (StudioInstance)
     {
         FMOD_3D_ATTRIBUTES attr = { { 0 } };
         attr.position = FMODUtils::ConvertWorldVector(GetComponentTransform().GetLocation());
@@ -164,12 +190,17 @@ void UFMODAudioComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransfor
 
         StudioInstance->set3DAttributes(&attr);
 
-        UpdateInteriorVolumes();
-        UpdateAttenuation();
-        ApplyVolumeLPF();
+        UpdateEnvironment();
     }
 }
 
+void UFMODAudioComponent::UpdateEnvironment()
+{
+    UpdateInteriorVolumes();
+    UpdateAttenuation();
+    ApplyVolumeLPF();
+}
+
 // Taken mostly from ActiveSound.cpp
 void UFMODAudioComponent::UpdateInteriorVolumes()
 {
@@ -272,23 +303,35 @@ void UFMODAudioComponent::UpdateAttenuation()
     // Use occlusion part of settings
     if (OcclusionDetails.bEnableOcclusion && bApplyOcclusionParameter)
     {
+        UWorld *World = GetWorld();
+        if (UFMODOcclusionManager *OcclusionManager = World->GetSubsystem<UFMODOcclusionManager>())
+        {
+            // Traced within the manager's budget, the result is applied when the trace completes
+            OcclusionManager->RequestOcclusion(this);
+            return;
+        }
+
         static FName NAME_SoundOcclusion = FName(TEXT("SoundOcclusion"));
         FCollisionQueryParams Params(NAME_SoundOcclusion, OcclusionDetails.bUseComplexCollisionForOcclusion, GetOwner());
 
         const FVector &Location = GetOwner()->GetTransform().GetTranslation();
         const FFMODListener &Listener = GetStudioModule().GetNearestListener(Location);
 
-        bool bIsOccluded = GWorld->LineTraceTestByChannel(Location, Listener.Transform.GetLocation(), OcclusionDetails.OcclusionTraceChannel, Params);
-
-        if (bIsOccluded != wasOccluded)
-        {
-            StudioInstance->setParameterByID(OcclusionID, bIsOccluded ? 1.0f : 0.0f);
-            wasOccluded = bIsOccluded;
-        }
+        bool bIsOccluded = World->LineTraceTestByChannel(Location, Listener.Transform.GetLocation(), OcclusionDetails.OcclusionTraceChannel, Params);
+        ApplyOcclusion(bIsOccluded ? 1.0f : 0.0f);
     }
     else
     {
-        wasOccluded = false;
+        LastOcclusion = 0.0f;
+    }
+}
+
+void UFMODAudioComponent::ApplyOcclusion(float Occlusion)
+{
+    if (Occlusion != LastOcclusion)
+    {
+        StudioInstance->setParameterByID(OcclusionID, Occlusion);
+        LastOcclusion = Occlusion;
     }
 }
 
@@ -317,32 +360,26 @@ void UFMODAudioComponent::ApplyVolumeLPF()
     }
 }
 
-bool UFMODAudioComponent::ShouldCacheParameter(const FMOD_STUDIO_PARAMETER_DESCRIPTION& ParameterDescription)
+bool UFMODAudioComponent::ShouldCacheParameter(const FFMODEventParameterInfo &Parameter)
 {
-    const UFMODSettings& Settings = *GetDefault<UFMODSettings>();
-
-    if (((ParameterDescription.flags & FMOD_STUDIO_PARAMETER_GLOBAL) == 0) &&
-        (ParameterDescription.type == FMOD_STUDIO_PARAMETER_GAME_CONTROLLED) &&
-        ParameterDescription.name != Settings.OcclusionParameter &&
-        ParameterDescription.name != Settings.AmbientVolumeParameter &&
-        ParameterDescription.name != Settings.AmbientLPFParameter)
-    {
-        return true;
-    }
-    return false;
+    return ((Parameter.Flags & FMOD_STUDIO_PARAMETER_GLOBAL) == 0) &&
+        (Parameter.Type == FMOD_STUDIO_PARAMETER_GAME_CONTROLLED) &&
+        !Parameter.bBuiltIn;
 }
 
 void UFMODAudioComponent::CacheDefaultParameterValues()
 {
     if (Event)
     {
-        TArray<FMOD_STUDIO_PARAMETER_DESCRIPTION> ParameterDescriptions;
-        Event->GetParameterDescriptions(ParameterDescriptions);
-        for (const FMOD_STUDIO_PARAMETER_DESCRIPTION &ParameterDescription : ParameterDescriptions)
+        TSharedPtr<const FFMODEventMetadata> Metadata = GetStudioModule().GetEventMetadata(Event);
+        if (Metadata.IsValid())
         {
-            if (!ParameterCache.Find(ParameterDescription.name) && ShouldCacheParameter(ParameterDescription))
+            for (const FFMODEventParameterInfo &Parameter : Metadata->Parameters)
             {
-                ParameterCache.Add(ParameterDescription.name, ParameterDescription.defaultvalue);
+                if (!ParameterCache.Find(Parameter.Name) && ShouldCacheParameter(Parameter))
+                {
+                    ParameterCache.Add(Parameter.Name, Parameter.DefaultValue);
+                }
             }
         }
         bDefaultParameterValuesCached = true;
@@ -353,15 +390,16 @@ void UFMODAudioComponent::UpdateCachedParameterValues()
 {
     if (bDefaultParameterValuesCached)
     {
-        TArray<FMOD_STUDIO_PARAMETER_DESCRIPTION> ParameterDescriptions;
-        Event->GetParameterDescriptions(ParameterDescriptions);
-        for (const FMOD_STUDIO_PARAMETER_DESCRIPTION& ParameterDescription : ParameterDescriptions)
+        TSharedPtr<const FFMODEventMetadata> Metadata = GetStudioModule().GetEventMetadata(Event);
+        if (Metadata.IsValid())
         {
-            if (ParameterCache.Find(ParameterDescription.name) && !ShouldCacheParameter(ParameterDescription))
+            for (const FFMODEventParameterInfo &Parameter : Metadata->Parameters)
             {
-                ParameterCache.Remove(ParameterDescription.name);
-                FString paramName(ParameterDescription.name);
-                UE_LOG(LogFMOD, Warning, TEXT("Parameter '%s' is driven elsewhere and cannot be added here."), *paramName)
+                if (ParameterCache.Find(Parameter.Name) && !ShouldCacheParameter(Parameter))
+                {
+                    ParameterCache.Remove(Parameter.Name);
+                    UE_LOG(LogFMOD, Warning, TEXT("Parameter '%s' is driven elsewhere and cannot be added here."), *Parameter.Name.ToString())
+                }
             }
         }
     }
@@ -369,11 +407,22 @@ void UFMODAudioComponent::UpdateCachedParameterValues()
 
 void UFMODAudioComponent::OnUnregister()
 {
+    RemoveBatchedTick();
+
     if (bStopWhenOwnerDestroyed)
     {
         Stop();
     }
     Release();
+
+    if (UWorld *World = GetWorld())
+    {
+        if (UFMODSampleDataPreloader *Preloader = World->GetSubsystem<UFMODSampleDataPreloader>())
+        {
+            Preloader->UnregisterComponent(this);
+        }
+    }
+
     Super::OnUnregister();
 }
 
@@ -421,39 +470,10 @@ void UFMODAudioComponent::TickComponent(float DeltaTime, enum ELevelTick TickTyp
         {
             if (GetStudioModule().HasListenerMoved())
             {
-                UpdateInteriorVolumes();
-                UpdateAttenuation();
-                ApplyVolumeLPF();
+                UpdateEnvironment();
             }
 
-            if (bEnableTimelineCallbacks)
-            {
-                TArray<FTimelineMarkerProperties> LocalMarkerQueue;
-                TArray<FTimelineBeatProperties> LocalBeatQueue;
-                {
-                    FScopeLock Lock(&CallbackLock);
-                    Swap(LocalMarkerQueue, CallbackMarkerQueue);
-                    Swap(LocalBeatQueue, CallbackBeatQueue);
-                }
-
-                for (const FTimelineMarkerProperties &EachProps : LocalMarkerQueue)
-                {
-                    OnTimelineMarker.Broadcast(EachProps.Name, EachProps.Position);
-                }
-                for (const FTimelineBeatProperties &EachProps : LocalBeatQueue)
-                {
-                    OnTimelineBeat.Broadcast(
-                        EachProps.Bar, EachProps.Beat, EachProps.Position, EachProps.Tempo, EachProps.TimeSignatureUpper, EachProps.TimeSignatureLower);
-                }
-            }
-
-            if (TriggerSoundStoppedDelegate)
-            {
-                FScopeLock Lock(&CallbackLock);
-                TriggerSoundStoppedDelegate = false;
-
-                OnSoundStopped.Broadcast();
-            }
+            DispatchCallbacks();
 
             StudioInstance->getPlaybackState(&state);
         }
@@ -465,6 +485,67 @@ void UFMODAudioComponent::TickComponent(float DeltaTime, enum ELevelTick TickTyp
     }
 }
 
+void UFMODAudioComponent::DispatchCallbacks()
+{
+    if (bEnableTimelineCallbacks)
+    {
+        TArray<FTimelineMarkerProperties> LocalMarkerQueue;
+        TArray<FTimelineBeatProperties> LocalBeatQueue;
+        {
+            FScopeLock Lock(&CallbackLock);
+            Swap(LocalMarkerQueue, CallbackMarkerQueue);
+            Swap(LocalBeatQueue, CallbackBeatQueue);
+        }
+
+        for (const FTimelineMarkerProperties &EachProps : LocalMarkerQueue)
+        {
+            OnTimelineMarker.Broadcast(EachProps.Name, EachProps.Position);
+        }
+        for (const FTimelineBeatProperties &EachProps : LocalBeatQueue)
+        {
+            OnTimelineBeat.Broadcast(
+                EachProps.Bar, EachProps.Beat, EachProps.Position, EachProps.Tempo, EachProps.TimeSignatureUpper, EachProps.TimeSignatureLower);
+        }
+    }
+
+    if (TriggerSoundStoppedDelegate)
+    {
+        FScopeLock Lock(&CallbackLock);
+        TriggerSoundStoppedDelegate = false;
+
+        OnSoundStopped.Broadcast();
+    }
+}
+
+void UFMODAudioComponent::UpdateBatchedTick()
+{
+    if (!IsActive())
+    {
+        return;
+    }
+
+    UWorld *World = GetWorld();
+    if (UFMODAudioComponentTickManager *TickManager = World ? World->GetSubsystem<UFMODAudioComponentTickManager>() : nullptr)
+    {
+        TickManager->AddComponent(this);
+    }
+}
+
+void UFMODAudioComponent::RemoveBatchedTick()
+{
+    if (BatchedTickIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    UWorld *World = GetWorld();
+    if (UFMODAudioComponentTickManager *TickManager = World ? World->GetSubsystem<UFMODAudioComponentTickManager>() : nullptr)
+    {
+        TickManager->RemoveComponent(this);
+    }
+    BatchedTickIndex = INDEX_NONE;
+}
+
 void UFMODAudioComponent::SetEvent(UFMODEvent *NewEvent)
 {
     const bool bPlay = IsPlaying();
@@ -504,6 +585,11 @@ void UFMODAudioComponent::Deactivate()
         Stop();
     }
     Super::Deactivate();
+
+    if (!IsActive())
+    {
+        RemoveBatchedTick();
+    }
 }
 
 FMOD_RESULT F_CALLBACK UFMODAudioComponent_EventCallback(FMOD_STUDIO_EVENT_CALLBACK_TYPE type, FMOD_STUDIO_EVENTINSTANCE *event, void *parameters)
@@ -720,7 +806,25 @@ void UFMODAudioComponent::PlayInternal(EFMODSystemContext::Type Context, bool bR
     FMOD::Studio::EventDescription *EventDesc = GetStudioModule().GetEventDescription(Event, Context);
     if (EventDesc != nullptr)
     {
-        EventDesc->getLength(&EventLength);
+        if (Context == EFMODSystemContext::Runtime)
+        {
+            GetStudioModule().NotifyEventPlayed(Event);
+        }
+
+        EventMetadata = GetStudioModule().GetEventMetadata(Event, Context);
+        if (!EventMetadata.IsValid())
+        {
+            return;
+        }
+
+        EventLength = EventMetadata->Length;
+        if (Context == EFMODSystemContext::Runtime &&
+            !GetStudioModule().RequestVoice(
+                Event, GetComponentLocation(), AttenuationDetails.bOverrideAttenuation ? AttenuationDetails.MaximumDistance : -1.0f))
+        {
+            return;
+        }
+
         if (!StudioInstance || !StudioInstance->isValid())
         {
             FMOD_RESULT result = EventDesc->createInstance(&StudioInstance);
@@ -728,48 +832,33 @@ void UFMODAudioComponent::PlayInternal(EFMODSystemContext::Type Context, bool bR
                 return;
         }
 
-        const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
-        FMOD_STUDIO_PARAMETER_DESCRIPTION paramDesc = {};
-        FString param = Settings.OcclusionParameter;
-        if (!param.IsEmpty())
+        if (EventMetadata->bHasOcclusionParameter)
         {
-            if (EventDesc->getParameterDescriptionByName(TCHAR_TO_UTF8(*Settings.OcclusionParameter), &paramDesc) == FMOD_OK)
-            {
-                OcclusionID = paramDesc.id;
-                bApplyOcclusionParameter = true;
-            }
+            OcclusionID = EventMetadata->OcclusionParameterId;
+            bApplyOcclusionParameter = true;
         }
 
-        paramDesc = {};
-        param = Settings.AmbientVolumeParameter;
-        if (!param.IsEmpty())
+        if (EventMetadata->bHasAmbientVolumeParameter)
         {
-            if (EventDesc->getParameterDescriptionByName(TCHAR_TO_UTF8(*param), &paramDesc) == FMOD_OK)
-            {
-                AmbientVolumeID = paramDesc.id;
-                LastVolume = -1.0f;     // Invalidate LastVolume so the AmbientVolumeParameter of the Event will be set later on
-                bApplyAmbientVolumes = true;
-            }
+            AmbientVolumeID = EventMetadata->AmbientVolumeParameterId;
+            LastVolume = -1.0f;     // Invalidate LastVolume so the AmbientVolumeParameter of the Event will be set later on
+            bApplyAmbientVolumes = true;
         }
 
-        paramDesc = {};
-        param = Settings.AmbientLPFParameter;
-        if (!param.IsEmpty())
+        if (EventMetadata->bHasAmbientLPFParameter)
         {
-            if (EventDesc->getParameterDescriptionByName(TCHAR_TO_UTF8(*Settings.AmbientLPFParameter), &paramDesc) == FMOD_OK)
-            {
-                AmbientLPFID = paramDesc.id;
-                LastLPF = -1.0f;     // Invalidate LastLPF so the AmbientLPFParameter of the Event will be set later on
-                bApplyAmbientVolumes = true;
-            }
+            AmbientLPFID = EventMetadata->AmbientLPFParameterId;
+            LastLPF = -1.0f;     // Invalidate LastLPF so the AmbientLPFParameter of the Event will be set later on
+            bApplyAmbientVolumes = true;
         }
 
-        OnUpdateTransform(EUpdateTransformFlags::SkipPhysicsUpdate);
+        // Submit the starting position now rather than with the next batch
+        Flush3DAttributes();
         // Set initial parameters
-        for (auto Kvp : ParameterCache)
+        for (const TPair<FName, float> &Kvp : ParameterCache)
         {
-            FMOD_RESULT Result = StudioInstance->setParameterByName(TCHAR_TO_UTF8(*Kvp.Key.ToString()), Kvp.Value);
-            if (Result != FMOD_OK)
+            const FFMODEventParameterInfo *Parameter = EventMetadata->FindParameter(Kvp.Key);
+            if (!Parameter || StudioInstance->setParameterByID(Parameter->Id, Kvp.Value) != FMOD_OK)
             {
                 UE_LOG(LogFMOD, Warning, TEXT("Failed to set initial parameter %s"), *Kvp.Key.ToString());
             }
@@ -795,10 +884,17 @@ void UFMODAudioComponent::PlayInternal(EFMODSystemContext::Type Context, bool bR
         verifyfmod(StudioInstance->start());
         UE_LOG(LogFMOD, Verbose, TEXT("Playing component %p"), this);
 
+        if (Context == EFMODSystemContext::Runtime)
+        {
+            GetStudioModule().TrackVoice(Event, StudioInstance);
+        }
+
         if (bReset || ShouldActivate() == true)
         {
             Super::Activate(bReset);
         }
+
+        UpdateBatchedTick();
     }
 }
 
@@ -810,7 +906,7 @@ void UFMODAudioComponent::Stop()
         StudioInstance->stop(FMOD_STUDIO_STOP_ALLOWFADEOUT);
     }
 
-    wasOccluded = false;
+    LastOcclusion = 0.0f;
 }
 
 void UFMODAudioComponent::Release()
@@ -843,6 +939,21 @@ void UFMODAudioComponent::ReleaseEventInstance()
         StudioInstance->release();
         StudioInstance = nullptr;
     }
+    EventMetadata.Reset();
+
+    if (UWorld *World = GetWorld())
+    {
+        if (UFMODOcclusionManager *OcclusionManager = World->GetSubsystem<UFMODOcclusionManager>())
+        {
+            OcclusionManager->RemoveComponent(this);
+        }
+    }
+
+    if (BatchedTickIndex != INDEX_NONE)
+    {
+        // Let the tick manager see the instance is gone
+        UpdateBatchedTick();
+    }
 }
 
 void UFMODAudioComponent::KeyOff()
@@ -859,6 +970,7 @@ void UFMODAudioComponent::OnPlaybackCompleted()
     // Mark inactive before calling destroy to avoid recursion
     SetActive(false);
     SetComponentTickEnabled(false);
+    RemoveBatchedTick();
 
     if (StudioInstance)
     {
@@ -921,7 +1033,9 @@ void UFMODAudioComponent::SetParameter(FName Name, float Value)
 {
     if (StudioInstance)
     {
-        FMOD_RESULT Result = StudioInstance->setParameterByName(TCHAR_TO_UTF8(*Name.ToString()), Value);
+        const FFMODEventParameterInfo *Parameter = EventMetadata.IsValid() ? EventMetadata->FindParameter(Name) : nullptr;
+        FMOD_RESULT Result = Parameter ? StudioInstance->setParameterByID(Parameter->Id, Value)
+                                       : StudioInstance->setParameterByName(TCHAR_TO_UTF8(*Name.ToString()), Value);
         if (Result != FMOD_OK)
         {
             UE_LOG(LogFMOD, Warning, TEXT("Failed to set parameter %s"), *Name.ToString());
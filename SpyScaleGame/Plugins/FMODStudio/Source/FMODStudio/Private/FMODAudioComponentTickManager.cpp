@@ -0,0 +1,177 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODAudioComponentTickManager.h"
+#include "FMODAudioComponent.h"
+#include "FMODSettings.h"
+#include "FMODStudioModule.h"
+#include "fmod_studio.hpp"
+#include "FMODStudioPrivatePCH.h"
+#include "CoreGlobals.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FMOD Batched Components"), STAT_FMOD_Batched_Components, STATGROUP_FMOD);
+
+namespace EFMODBatchedTickFlags
+{
+enum Type : uint8
+{
+    /** Ambient volumes, attenuation override or occlusion need updating when the listener moves */
+    UpdateEnvironment = 1 << 0,
+    /** Studio callbacks may queue delegates to broadcast */
+    DispatchCallbacks = 1 << 1,
+};
+}
+
+UFMODAudioComponentTickManager::UFMODAudioComponentTickManager(const FObjectInitializer &ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+}
+
+bool UFMODAudioComponentTickManager::ShouldCreateSubsystem(UObject *Outer) const
+{
+    return Super::ShouldCreateSubsystem(Outer) && GetDefault<UFMODSettings>()->bBatchAudioComponentTicks;
+}
+
+bool UFMODAudioComponentTickManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFMODAudioComponentTickManager::AddComponent(UFMODAudioComponent *Component)
+{
+    if (!IsValid(Component))
+    {
+        return;
+    }
+
+    int32 Index = Component->BatchedTickIndex;
+    if (Index == INDEX_NONE)
+    {
+        Index = Components.Add(Component);
+        Instances.Add(nullptr);
+        Flags.Add(0);
+        AddedFrames.Add(0);
+        Component->BatchedTickIndex = Index;
+        INC_DWORD_STAT(STAT_FMOD_Batched_Components);
+    }
+
+    // Flags capture the component's settings as of its last play
+    uint8 NewFlags = 0;
+    if (Component->bApplyAmbientVolumes || Component->AttenuationDetails.bOverrideAttenuation || Component->OcclusionDetails.bEnableOcclusion)
+    {
+        NewFlags |= EFMODBatchedTickFlags::UpdateEnvironment;
+    }
+    if (Component->bEnableTimelineCallbacks || !Component->ProgrammerSoundName.IsEmpty())
+    {
+        NewFlags |= EFMODBatchedTickFlags::DispatchCallbacks;
+    }
+
+    Instances[Index] = Component->StudioInstance;
+    Flags[Index] = NewFlags;
+    AddedFrames[Index] = GFrameCounter;
+
+    Component->SetComponentTickEnabled(false);
+}
+
+void UFMODAudioComponentTickManager::RemoveComponent(UFMODAudioComponent *Component)
+{
+    const int32 Index = Component ? Component->BatchedTickIndex : INDEX_NONE;
+    if (!Components.IsValidIndex(Index) || Components[Index] != Component)
+    {
+        return;
+    }
+
+    Components.RemoveAtSwap(Index);
+    Instances.RemoveAtSwap(Index);
+    Flags.RemoveAtSwap(Index);
+    AddedFrames.RemoveAtSwap(Index);
+
+    if (Components.IsValidIndex(Index))
+    {
+        Components[Index]->BatchedTickIndex = Index;
+    }
+    Component->BatchedTickIndex = INDEX_NONE;
+    DEC_DWORD_STAT(STAT_FMOD_Batched_Components);
+}
+
+void UFMODAudioComponentTickManager::Deinitialize()
+{
+    for (UFMODAudioComponent *Component : Components)
+    {
+        Component->BatchedTickIndex = INDEX_NONE;
+    }
+    DEC_DWORD_STAT_BY(STAT_FMOD_Batched_Components, Components.Num());
+
+    Components.Empty();
+    Instances.Empty();
+    Flags.Empty();
+    AddedFrames.Empty();
+
+    Super::Deinitialize();
+}
+
+void UFMODAudioComponentTickManager::Tick(float DeltaTime)
+{
+    if (Components.Num() == 0 || !IFMODStudioModule::IsAvailable())
+    {
+        return;
+    }
+
+    const bool bListenerMoved = IFMODStudioModule::Get().HasListenerMoved();
+    const int32 Count = Components.Num();
+
+    PlaybackStates.SetNumUninitialized(Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        PlaybackStates[i] = FMOD_STUDIO_PLAYBACK_STOPPED;
+        if (Instances[i])
+        {
+            Instances[i]->getPlaybackState(&PlaybackStates[i]);
+        }
+    }
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        if (Instances[i] && bListenerMoved && (Flags[i] & EFMODBatchedTickFlags::UpdateEnvironment))
+        {
+            Components[i]->UpdateEnvironment();
+        }
+
+        if (Instances[i] && (Flags[i] & EFMODBatchedTickFlags::DispatchCallbacks))
+        {
+            CallbackComponents.Add(Components[i]);
+        }
+
+        // A component started this frame may not show as playing until Studio has processed the start
+        if (PlaybackStates[i] == FMOD_STUDIO_PLAYBACK_STOPPED && AddedFrames[i] != GFrameCounter)
+        {
+            CompletedComponents.Add(Components[i]);
+        }
+    }
+
+    // Delegates can play, stop or destroy components, so they are broadcast once the arrays are no longer being walked
+    for (const TWeakObjectPtr<UFMODAudioComponent> &Component : CallbackComponents)
+    {
+        if (UFMODAudioComponent *Callbacks = Component.Get())
+        {
+            Callbacks->DispatchCallbacks();
+        }
+    }
+
+    for (const TWeakObjectPtr<UFMODAudioComponent> &Component : CompletedComponents)
+    {
+        UFMODAudioComponent *Completed = Component.Get();
+        if (Completed && Completed->IsActive() && Completed->BatchedTickIndex != INDEX_NONE &&
+            AddedFrames[Completed->BatchedTickIndex] != GFrameCounter)
+        {
+            Completed->OnPlaybackCompleted();
+        }
+    }
+
+    CallbackComponents.Reset();
+    CompletedComponents.Reset();
+}
+
+TStatId UFMODAudioComponentTickManager::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UFMODAudioComponentTickManager, STATGROUP_Tickables);
+}
@@ -0,0 +1,54 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+
+/**
+ * Layout of a packed bank container: a header holding the bank index, followed by each bank's bytes.
+ * Every bank starts on an Alignment boundary so it can be handed to FMOD in place.
+ */
+namespace FMODBankContainer
+{
+    static const uint32 Magic = 0x43424D46; // 'FMBC'
+    static const uint32 Version = 1;
+    static const int64 Alignment = 4096;
+
+    /** Container file name, written to and read from the platform bank directory. */
+    inline FString GetFilename() { return FString(TEXT("Banks.fmodbanks")); }
+}
+
+struct FFMODBankContainerEntry
+{
+    /** Bank path relative to the platform bank directory, using forward slashes. */
+    FString Name;
+    int64 Offset = 0;
+    int64 Size = 0;
+
+    friend FArchive &operator<<(FArchive &Ar, FFMODBankContainerEntry &Entry)
+    {
+        Ar << Entry.Name;
+        Ar << Entry.Offset;
+        Ar << Entry.Size;
+        return Ar;
+    }
+};
+
+struct FFMODBankContainerHeader
+{
+    uint32 Magic = FMODBankContainer::Magic;
+    uint32 Version = FMODBankContainer::Version;
+    TArray<FFMODBankContainerEntry> Entries;
+
+    friend FArchive &operator<<(FArchive &Ar, FFMODBankContainerHeader &Header)
+    {
+        Ar << Header.Magic;
+        Ar << Header.Version;
+        if (Header.Magic == FMODBankContainer::Magic && Header.Version == FMODBankContainer::Version)
+        {
+            Ar << Header.Entries;
+        }
+        return Ar;
+    }
+};
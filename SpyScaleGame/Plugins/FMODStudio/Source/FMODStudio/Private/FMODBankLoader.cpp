@@ -0,0 +1,338 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODBankLoader.h"
+#include "FMODBankContainer.h"
+#include "FMODSettings.h"
+#include "FMODUtils.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "FMODStudioPrivatePCH.h"
+
+#include <atomic>
+
+/** A bank file mapped into memory, shared by every Studio system that loads the same path. */
+struct FFMODMappedBank
+{
+    FString Path;
+    IMappedFileHandle *Handle = nullptr;
+    IMappedFileRegion *Region = nullptr;
+    int32 RefCount = 0;
+};
+
+class FFMODMappedBankRegistry
+{
+public:
+    FFMODMappedBank *Acquire(const FString &Path)
+    {
+        FScopeLock lock(&Crit);
+
+        if (FFMODMappedBank **Existing = Banks.Find(Path))
+        {
+            ++(*Existing)->RefCount;
+            return *Existing;
+        }
+
+        IMappedFileHandle *Handle = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path);
+        if (!Handle)
+        {
+            return nullptr;
+        }
+
+        IMappedFileRegion *Region = Handle->MapRegion(0, Handle->GetFileSize());
+        if (!Region)
+        {
+            delete Handle;
+            return nullptr;
+        }
+
+        // Mapped regions start on a page boundary, which satisfies FMOD_STUDIO_LOAD_MEMORY_ALIGNMENT
+        check(IsAligned(Region->GetMappedPtr(), FMOD_STUDIO_LOAD_MEMORY_ALIGNMENT));
+
+        FFMODMappedBank *Bank = new FFMODMappedBank;
+        Bank->Path = Path;
+        Bank->Handle = Handle;
+        Bank->Region = Region;
+        Bank->RefCount = 1;
+        Banks.Add(Path, Bank);
+
+        UE_LOG(LogFMOD, Verbose, TEXT("Mapped bank %s (%lld bytes)"), *Path, Region->GetMappedSize());
+        return Bank;
+    }
+
+    void Release(FFMODMappedBank *Bank)
+    {
+        FScopeLock lock(&Crit);
+
+        check(Bank->RefCount > 0);
+        if (--Bank->RefCount == 0)
+        {
+            UE_LOG(LogFMOD, Verbose, TEXT("Unmapped bank %s"), *Bank->Path);
+            Banks.Remove(Bank->Path);
+            delete Bank->Region;
+            delete Bank->Handle;
+            delete Bank;
+        }
+    }
+
+private:
+    TMap<FString, FFMODMappedBank *> Banks;
+    FCriticalSection Crit;
+};
+
+static FFMODMappedBankRegistry gMappedBanks;
+
+/** Index and shared file handle for the packed bank container. */
+class FFMODBankContainerReader
+{
+public:
+    /** Returns the container entry for a full bank path, opening the container on first use. */
+    const FFMODBankContainerEntry *Find(const FString &Path)
+    {
+        FScopeLock lock(&Crit);
+
+        if (!bOpened)
+        {
+            Open();
+        }
+
+        FString Name = Path;
+        FPaths::NormalizeFilename(Name);
+        if (!Name.StartsWith(BankDirectory) || Entries.Num() == 0)
+        {
+            return nullptr;
+        }
+
+        return Entries.Find(Name.RightChop(BankDirectory.Len()));
+    }
+
+    FMOD_RESULT Read(int64 Offset, void *Buffer, int64 Size)
+    {
+        FScopeLock lock(&Crit);
+
+        if (!Reader)
+        {
+            return FMOD_ERR_FILE_BAD;
+        }
+
+        Reader->Seek(Offset);
+        Reader->Serialize(Buffer, Size);
+        return Reader->IsError() ? FMOD_ERR_FILE_BAD : FMOD_OK;
+    }
+
+    const FString &GetPath() const { return ContainerPath; }
+
+private:
+    void Open()
+    {
+        const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+
+        bOpened = true;
+        BankDirectory = Settings.GetFullBankPath() + TEXT("/");
+        FPaths::NormalizeFilename(BankDirectory);
+        ContainerPath = BankDirectory + FMODBankContainer::GetFilename();
+
+        Reader.Reset(IFileManager::Get().CreateFileReader(*ContainerPath));
+        if (!Reader)
+        {
+            UE_LOG(LogFMOD, Warning, TEXT("Bank container %s not found, loading loose bank files"), *ContainerPath);
+            return;
+        }
+
+        FFMODBankContainerHeader Header;
+        *Reader << Header;
+        if (Header.Magic != FMODBankContainer::Magic || Header.Version != FMODBankContainer::Version || Reader->IsError())
+        {
+            UE_LOG(LogFMOD, Warning, TEXT("Bank container %s is invalid or out of date, loading loose bank files"), *ContainerPath);
+            Reader.Reset();
+            return;
+        }
+
+        for (FFMODBankContainerEntry &Entry : Header.Entries)
+        {
+            Entries.Add(Entry.Name, Entry);
+        }
+
+        UE_LOG(LogFMOD, Log, TEXT("Opened bank container %s with %d banks"), *ContainerPath, Entries.Num());
+    }
+
+    bool bOpened = false;
+    FString BankDirectory;
+    FString ContainerPath;
+    TUniquePtr<FArchive> Reader;
+
+    // Built once when the container is opened, so entry pointers stay valid
+    TMap<FString, FFMODBankContainerEntry> Entries;
+    FCriticalSection Crit;
+};
+
+static FFMODBankContainerReader gBankContainer;
+
+/** Read cursor for one bank inside the container, created by FMOD through loadBankCustom. */
+struct FFMODBankContainerCursor
+{
+    const FFMODBankContainerEntry *Entry;
+    int64 Position;
+};
+
+static FMOD_RESULT F_CALLBACK FMODContainerOpenCallback(const char *name, unsigned int *filesize, void **handle, void *userdata)
+{
+    const FFMODBankContainerEntry *Entry = (const FFMODBankContainerEntry *)userdata;
+    *filesize = (unsigned int)Entry->Size;
+    *handle = new FFMODBankContainerCursor{ Entry, 0 };
+    return FMOD_OK;
+}
+
+static FMOD_RESULT F_CALLBACK FMODContainerCloseCallback(void *handle, void *userdata)
+{
+    delete (FFMODBankContainerCursor *)handle;
+    return FMOD_OK;
+}
+
+static FMOD_RESULT F_CALLBACK FMODContainerReadCallback(void *handle, void *buffer, unsigned int sizebytes, unsigned int *bytesread, void *userdata)
+{
+    FFMODBankContainerCursor *Cursor = (FFMODBankContainerCursor *)handle;
+    int64 ReadAmount = FMath::Clamp((int64)sizebytes, (int64)0, Cursor->Entry->Size - Cursor->Position);
+
+    FMOD_RESULT Result = gBankContainer.Read(Cursor->Entry->Offset + Cursor->Position, buffer, ReadAmount);
+    if (Result != FMOD_OK)
+    {
+        *bytesread = 0;
+        return Result;
+    }
+
+    Cursor->Position += ReadAmount;
+    *bytesread = (unsigned int)ReadAmount;
+    return ReadAmount < (int64)sizebytes ? FMOD_ERR_FILE_EOF : FMOD_OK;
+}
+
+static FMOD_RESULT F_CALLBACK FMODContainerSeekCallback(void *handle, unsigned int pos, void *userdata)
+{
+    FFMODBankContainerCursor *Cursor = (FFMODBankContainerCursor *)handle;
+    Cursor->Position = pos;
+    return FMOD_OK;
+}
+
+static FMOD_RESULT LoadFMODBankFromContainer(FMOD::Studio::System *system, const FFMODBankContainerEntry &entry, FMOD_STUDIO_LOAD_BANK_FLAGS flags,
+    FMOD::Studio::Bank **bank)
+{
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+
+    if (Settings.bMemoryMapBanks)
+    {
+        // Every bank shares one mapping of the whole container
+        FFMODMappedBank *MappedContainer = gMappedBanks.Acquire(gBankContainer.GetPath());
+        if (MappedContainer)
+        {
+            const char *Data = (const char *)MappedContainer->Region->GetMappedPtr() + entry.Offset;
+            FMOD_RESULT Result = system->loadBankMemory(Data, (int)entry.Size, FMOD_STUDIO_LOAD_MEMORY_POINT, flags, bank);
+            if (Result == FMOD_OK)
+            {
+                verifyfmod((*bank)->setUserData(MappedContainer));
+            }
+            else
+            {
+                gMappedBanks.Release(MappedContainer);
+            }
+            return Result;
+        }
+    }
+
+    FMOD_STUDIO_BANK_INFO Info = {};
+    Info.size = sizeof(Info);
+    Info.userdata = (void *)&entry;
+    Info.userdatalength = 0;
+    Info.opencallback = FMODContainerOpenCallback;
+    Info.closecallback = FMODContainerCloseCallback;
+    Info.readcallback = FMODContainerReadCallback;
+    Info.seekcallback = FMODContainerSeekCallback;
+
+    return system->loadBankCustom(&Info, flags, bank);
+}
+
+// Starts at one so zero initialized caches are never current
+static std::atomic<uint32> gBankGeneration{ 1 };
+
+uint32 GetFMODBankGeneration()
+{
+    return gBankGeneration.load();
+}
+
+void BumpFMODBankGeneration()
+{
+    ++gBankGeneration;
+}
+
+static FMOD_RESULT F_CALLBACK FMODBankUnloadCallback(FMOD_STUDIO_SYSTEM *system, FMOD_STUDIO_SYSTEM_CALLBACK_TYPE type, void *commanddata, void *userdata)
+{
+    if (type == FMOD_STUDIO_SYSTEM_CALLBACK_BANK_UNLOAD)
+    {
+        // Called for every unload, including ones made directly through the Studio API
+        BumpFMODBankGeneration();
+
+        FMOD::Studio::Bank *Bank = (FMOD::Studio::Bank *)commanddata;
+        FFMODMappedBank *MappedBank = nullptr;
+        if (Bank->getUserData((void **)&MappedBank) == FMOD_OK && MappedBank)
+        {
+            Bank->setUserData(nullptr);
+            gMappedBanks.Release(MappedBank);
+        }
+    }
+    return FMOD_OK;
+}
+
+void AttachFMODBankLoader(FMOD::Studio::System *system)
+{
+    verifyfmod(system->setCallback(FMODBankUnloadCallback, FMOD_STUDIO_SYSTEM_CALLBACK_BANK_UNLOAD));
+}
+
+FMOD_RESULT LoadFMODBank(FMOD::Studio::System *system, const FString &path, FMOD_STUDIO_LOAD_BANK_FLAGS flags, FMOD::Studio::Bank **bank)
+{
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+
+    if (Settings.bUseBankContainer)
+    {
+        if (const FFMODBankContainerEntry *Entry = gBankContainer.Find(path))
+        {
+            return LoadFMODBankFromContainer(system, *Entry, flags, bank);
+        }
+    }
+
+    if (Settings.bMemoryMapBanks)
+    {
+        FFMODMappedBank *MappedBank = gMappedBanks.Acquire(path);
+        if (MappedBank)
+        {
+            FMOD_RESULT Result = system->loadBankMemory((const char *)MappedBank->Region->GetMappedPtr(), (int)MappedBank->Region->GetMappedSize(),
+                FMOD_STUDIO_LOAD_MEMORY_POINT, flags, bank);
+            if (Result == FMOD_OK)
+            {
+                // The mapping is released by FMODBankUnloadCallback once FMOD has finished with the bank
+                verifyfmod((*bank)->setUserData(MappedBank));
+            }
+            else
+            {
+                gMappedBanks.Release(MappedBank);
+            }
+            return Result;
+        }
+
+        UE_LOG(LogFMOD, Verbose, TEXT("Could not map bank %s, loading from file instead"), *path);
+    }
+
+    return system->loadBankFile(TCHAR_TO_UTF8(*path), flags, bank);
+}
+
+bool FMODBankExists(const FString &path)
+{
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+
+    if (Settings.bUseBankContainer && gBankContainer.Find(path))
+    {
+        return true;
+    }
+
+    return FPaths::FileExists(path);
+}
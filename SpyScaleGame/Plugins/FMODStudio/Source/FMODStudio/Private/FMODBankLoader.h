@@ -0,0 +1,27 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "fmod_studio.hpp"
+#include "Containers/UnrealString.h"
+
+/** Installs the bank unload callback that releases memory mapped banks. Call once per Studio system after initialization. */
+void AttachFMODBankLoader(FMOD::Studio::System *system);
+
+/**
+ * Loads a bank from the bank container when bUseBankContainer is enabled, otherwise from disk.
+ * Banks are memory mapped when bMemoryMapBanks is enabled, falling back to loadBankFile or reading through the container's file handle.
+ */
+FMOD_RESULT LoadFMODBank(FMOD::Studio::System *system, const FString &path, FMOD_STUDIO_LOAD_BANK_FLAGS flags, FMOD::Studio::Bank **bank);
+
+/** Whether a bank can be loaded from the given path, either from the bank container or from disk. */
+bool FMODBankExists(const FString &path);
+
+/**
+ * Incremented whenever a bank is unloaded from any Studio system, or when banks are reloaded or a system is released.
+ * Event description handles cached against an older generation must be looked up again.
+ */
+uint32 GetFMODBankGeneration();
+
+/** Invalidate handles cached against the current bank generation. */
+void BumpFMODBankGeneration();
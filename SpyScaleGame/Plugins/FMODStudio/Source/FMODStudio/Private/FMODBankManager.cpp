@@ -0,0 +1,183 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODBankManager.h"
+#include "FMODBank.h"
+#include "FMODBankRequirementComponent.h"
+#include "FMODStudioModule.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "FMODStudioPrivatePCH.h"
+
+UFMODBankManager::UFMODBankManager(const FObjectInitializer &ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+}
+
+bool UFMODBankManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFMODBankManager::AcquireBank(UFMODBank *Bank)
+{
+    if (IsValid(Bank))
+    {
+        AcquireBankByGuid(Bank->AssetGuid, Bank);
+    }
+}
+
+void UFMODBankManager::ReleaseBank(UFMODBank *Bank)
+{
+    if (IsValid(Bank))
+    {
+        ReleaseBankByGuid(Bank->AssetGuid);
+    }
+}
+
+void UFMODBankManager::AcquireBanks(const TArray<UFMODBank *> &Banks)
+{
+    for (UFMODBank *Bank : Banks)
+    {
+        AcquireBank(Bank);
+    }
+}
+
+void UFMODBankManager::ReleaseBanks(const TArray<UFMODBank *> &Banks)
+{
+    for (UFMODBank *Bank : Banks)
+    {
+        ReleaseBank(Bank);
+    }
+}
+
+int32 UFMODBankManager::GetBankRefCount(UFMODBank *Bank) const
+{
+    return IsValid(Bank) ? IFMODStudioModule::Get().GetManagedBankRefCount(Bank->AssetGuid) : 0;
+}
+
+bool UFMODBankManager::IsBankLoaded(UFMODBank *Bank) const
+{
+    return IsValid(Bank) && IFMODStudioModule::Get().IsManagedBankLoaded(Bank->AssetGuid);
+}
+
+void UFMODBankManager::AcquireBankByGuid(const FGuid &Guid, UFMODBank *Bank)
+{
+    if (!Bank)
+    {
+        return;
+    }
+
+    if (IFMODStudioModule::Get().AcquireManagedBank(*Bank))
+    {
+        ++HeldBanks.FindOrAdd(Guid);
+    }
+}
+
+void UFMODBankManager::ReleaseBankByGuid(const FGuid &Guid)
+{
+    int32 *Held = HeldBanks.Find(Guid);
+    if (!Held)
+    {
+        return;
+    }
+
+    IFMODStudioModule::Get().ReleaseManagedBank(Guid);
+    if (--*Held == 0)
+    {
+        HeldBanks.Remove(Guid);
+    }
+}
+
+void UFMODBankManager::UpdateStreamingLevels()
+{
+    UWorld *World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    TSet<TObjectKey<ULevel>> LoadedLevels;
+
+    for (ULevelStreaming *StreamingLevel : World->GetStreamingLevels())
+    {
+        ULevel *Level = StreamingLevel ? StreamingLevel->GetLoadedLevel() : nullptr;
+        if (!Level)
+        {
+            continue;
+        }
+
+        TObjectKey<ULevel> LevelKey(Level);
+        LoadedLevels.Add(LevelKey);
+
+        if (LevelBanks.Contains(LevelKey))
+        {
+            continue;
+        }
+
+        // The level has just finished loading, it may not be visible yet
+        TArray<FGuid> &Guids = LevelBanks.Add(LevelKey);
+        for (AActor *Actor : Level->Actors)
+        {
+            if (!Actor)
+            {
+                continue;
+            }
+
+            TInlineComponentArray<UFMODBankRequirementComponent *> Requirements(Actor);
+            for (UFMODBankRequirementComponent *Requirement : Requirements)
+            {
+                for (UFMODBank *Bank : Requirement->Banks)
+                {
+                    if (IsValid(Bank))
+                    {
+                        AcquireBankByGuid(Bank->AssetGuid, Bank);
+                        Guids.Add(Bank->AssetGuid);
+                    }
+                }
+            }
+        }
+    }
+
+    for (auto It = LevelBanks.CreateIterator(); It; ++It)
+    {
+        if (!LoadedLevels.Contains(It.Key()))
+        {
+            for (const FGuid &Guid : It.Value())
+            {
+                ReleaseBankByGuid(Guid);
+            }
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void UFMODBankManager::Tick(float DeltaTime)
+{
+    UpdateStreamingLevels();
+}
+
+TStatId UFMODBankManager::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UFMODBankManager, STATGROUP_Tickables);
+}
+
+void UFMODBankManager::Deinitialize()
+{
+    // Pending unloads are kept by the module, so the next world can take these banks back within the grace period
+    if (IFMODStudioModule::IsAvailable())
+    {
+        for (const TPair<FGuid, int32> &Pair : HeldBanks)
+        {
+            for (int32 i = 0; i < Pair.Value; ++i)
+            {
+                IFMODStudioModule::Get().ReleaseManagedBank(Pair.Key);
+            }
+        }
+    }
+    HeldBanks.Reset();
+    LevelBanks.Reset();
+
+    Super::Deinitialize();
+}
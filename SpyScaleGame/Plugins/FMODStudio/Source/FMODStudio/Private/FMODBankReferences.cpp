@@ -0,0 +1,143 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODBankReferences.h"
+#include "FMODBankLoader.h"
+#include "FMODSettings.h"
+#include "FMODUtils.h"
+#include "fmod_studio.hpp"
+#include "fmod_errors.h"
+#include "FMODStudioPrivatePCH.h"
+
+bool FFMODBankReferences::Acquire(FMOD::Studio::System *System, const FGuid &Guid, const FString &BankPath, const FString &Name)
+{
+    if (FManagedBank *Managed = ManagedBanks.Find(Guid))
+    {
+        ++Managed->RefCount;
+        Managed->UnloadTime = 0.0;
+        return true;
+    }
+
+    if (!System || BankPath.IsEmpty())
+    {
+        return false;
+    }
+
+    FManagedBank Managed;
+    Managed.Name = Name;
+    Managed.RefCount = 1;
+
+    FMOD_RESULT Result = LoadFMODBank(System, BankPath, FMOD_STUDIO_LOAD_BANK_NONBLOCKING, &Managed.Bank);
+    if (Result == FMOD_OK)
+    {
+        UE_LOG(LogFMOD, Log, TEXT("BankManager loading bank %s"), *Managed.Name);
+        Managed.bOwned = true;
+    }
+    else if (Result == FMOD_ERR_EVENT_ALREADY_LOADED)
+    {
+        // Loaded at startup or through UFMODBlueprintStatics::LoadBank, so not ours to unload
+        FMOD::Studio::ID FMODGuid = FMODUtils::ConvertGuid(Guid);
+        System->getBankByID(&FMODGuid, &Managed.Bank);
+        Managed.bOwned = false;
+    }
+    else
+    {
+        UE_LOG(LogFMOD, Error, TEXT("BankManager failed to load bank %s: %s"), *Managed.Name, UTF8_TO_TCHAR(FMOD_ErrorString(Result)));
+        return false;
+    }
+
+    ManagedBanks.Add(Guid, Managed);
+    return true;
+}
+
+void FFMODBankReferences::Release(const FGuid &Guid)
+{
+    FManagedBank *Managed = ManagedBanks.Find(Guid);
+    if (!Managed || Managed->RefCount <= 0)
+    {
+        return;
+    }
+
+    if (--Managed->RefCount == 0)
+    {
+        const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+        Managed->UnloadTime = FPlatformTime::Seconds() + Settings.BankUnloadGracePeriod;
+    }
+}
+
+int32 FFMODBankReferences::GetRefCount(const FGuid &Guid) const
+{
+    const FManagedBank *Managed = ManagedBanks.Find(Guid);
+    return Managed ? Managed->RefCount : 0;
+}
+
+bool FFMODBankReferences::IsLoaded(const FGuid &Guid) const
+{
+    const FManagedBank *Managed = ManagedBanks.Find(Guid);
+    if (Managed && Managed->Bank)
+    {
+        FMOD_STUDIO_LOADING_STATE LoadingState;
+        if (Managed->Bank->getLoadingState(&LoadingState) == FMOD_OK)
+        {
+            return LoadingState == FMOD_STUDIO_LOADING_STATE_LOADED;
+        }
+    }
+    return false;
+}
+
+void FFMODBankReferences::Unload(FMOD::Studio::System *System, const FGuid &Guid, FManagedBank &Managed)
+{
+    if (Managed.bOwned && Managed.Bank && System)
+    {
+        // SwitchLocale replaces localized banks with a new handle under the same ID
+        if (!Managed.Bank->isValid())
+        {
+            FMOD::Studio::ID FMODGuid = FMODUtils::ConvertGuid(Guid);
+            System->getBankByID(&FMODGuid, &Managed.Bank);
+        }
+
+        UE_LOG(LogFMOD, Log, TEXT("BankManager unloading bank %s"), *Managed.Name);
+        if (Managed.Bank)
+        {
+            Managed.Bank->unload();
+        }
+    }
+    Managed.Bank = nullptr;
+}
+
+void FFMODBankReferences::Update(FMOD::Studio::System *System)
+{
+    if (ManagedBanks.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+
+    for (auto It = ManagedBanks.CreateIterator(); It; ++It)
+    {
+        FManagedBank &Managed = It.Value();
+
+        if (Managed.RefCount == 0 && Now >= Managed.UnloadTime)
+        {
+            Unload(System, It.Key(), Managed);
+            It.RemoveCurrent();
+            continue;
+        }
+
+        if (Managed.bOwned && Managed.Bank)
+        {
+            FMOD_STUDIO_LOADING_STATE LoadingState;
+            if (Managed.Bank->getLoadingState(&LoadingState) == FMOD_OK && LoadingState == FMOD_STUDIO_LOADING_STATE_ERROR)
+            {
+                UE_LOG(LogFMOD, Error, TEXT("BankManager failed to load bank %s"), *Managed.Name);
+                Unload(System, It.Key(), Managed);
+                It.RemoveCurrent();
+            }
+        }
+    }
+}
+
+void FFMODBankReferences::Reset()
+{
+    ManagedBanks.Reset();
+}
@@ -0,0 +1,54 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace FMOD
+{
+namespace Studio
+{
+class System;
+class Bank;
+}
+}
+
+/**
+ * Reference counts runtime bank loads made through UFMODBankManager. Owned by the module so references and pending
+ * unloads survive world teardown: a bank released when one world ends stays loaded for BankUnloadGracePeriod, and
+ * the next world can take it back without a reload. Game thread only.
+ */
+class FFMODBankReferences
+{
+public:
+    /** Add a reference to a bank, loading it asynchronously from BankPath if it is not already loaded. Returns false if it can't be loaded. */
+    bool Acquire(FMOD::Studio::System *System, const FGuid &Guid, const FString &BankPath, const FString &Name);
+
+    /** Remove a reference. The bank is unloaded once unreferenced for the grace period. */
+    void Release(const FGuid &Guid);
+
+    int32 GetRefCount(const FGuid &Guid) const;
+    bool IsLoaded(const FGuid &Guid) const;
+
+    /** Unload banks whose grace period has expired and drop banks that failed to load. Called from the module tick. */
+    void Update(FMOD::Studio::System *System);
+
+    /** Forget all references, used when runtime banks are unloaded. */
+    void Reset();
+
+private:
+    struct FManagedBank
+    {
+        FString Name;
+        FMOD::Studio::Bank *Bank = nullptr;
+        int32 RefCount = 0;
+        double UnloadTime = 0.0;
+
+        // False when the bank was already loaded by someone else, in which case we never unload it
+        bool bOwned = false;
+    };
+
+    static void Unload(FMOD::Studio::System *System, const FGuid &Guid, FManagedBank &Managed);
+
+    TMap<FGuid, FManagedBank> ManagedBanks;
+};
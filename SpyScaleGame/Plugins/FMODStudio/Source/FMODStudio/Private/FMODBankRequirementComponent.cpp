@@ -0,0 +1,37 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODBankRequirementComponent.h"
+#include "FMODBankManager.h"
+#include "Engine/World.h"
+#include "FMODStudioPrivatePCH.h"
+
+UFMODBankRequirementComponent::UFMODBankRequirementComponent(const FObjectInitializer &ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+}
+
+void UFMODBankRequirementComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    UWorld *World = GetWorld();
+    UFMODBankManager *BankManager = World ? World->GetSubsystem<UFMODBankManager>() : nullptr;
+    if (BankManager)
+    {
+        AcquiredBanks = Banks;
+        BankManager->AcquireBanks(AcquiredBanks);
+    }
+}
+
+void UFMODBankRequirementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UWorld *World = GetWorld();
+    UFMODBankManager *BankManager = World ? World->GetSubsystem<UFMODBankManager>() : nullptr;
+    if (BankManager)
+    {
+        BankManager->ReleaseBanks(AcquiredBanks);
+    }
+    AcquiredBanks.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
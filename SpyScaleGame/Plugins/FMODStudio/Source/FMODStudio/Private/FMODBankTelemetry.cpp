@@ -0,0 +1,188 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODBankTelemetry.h"
+#include "FMODUtils.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tasks/Pipe.h"
+#include "fmod_errors.h"
+#include "FMODStudioPrivatePCH.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FMOD Bank - Loads"), STAT_FMOD_Bank_Loads, STATGROUP_FMOD);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("FMOD Bank - Queue Time (ms)"), STAT_FMOD_Bank_QueueTime, STATGROUP_FMOD);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("FMOD Bank - Load Time (ms)"), STAT_FMOD_Bank_LoadTime, STATGROUP_FMOD);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("FMOD Bank - Sample Data Time (ms)"), STAT_FMOD_Bank_SampleDataTime, STATGROUP_FMOD);
+DECLARE_MEMORY_STAT(TEXT("FMOD Bank - Memory Delta"), STAT_FMOD_Bank_MemoryDelta, STATGROUP_FMOD);
+
+static int64 GetFMODCurrentMemory()
+{
+    int CurrentAlloced = 0, MaxAlloced = 0;
+    FMOD::Memory_GetStats(&CurrentAlloced, &MaxAlloced, false);
+    return CurrentAlloced;
+}
+
+// FMOD memory when a load last finished. Loads overlap, so each one is only charged with the growth since the previous one
+// finished, which keeps the same memory from being counted against several banks. Only touched from the game thread.
+static int64 LastAttributedMemory = 0;
+
+static int64 TakeFMODMemoryDelta(int64 StartMemory)
+{
+    const int64 CurrentMemory = GetFMODCurrentMemory();
+    const int64 Delta = CurrentMemory - FMath::Max(StartMemory, LastAttributedMemory);
+    LastAttributedMemory = CurrentMemory;
+    return Delta;
+}
+
+void FFMODBankLoadTimings::BeginQueue()
+{
+    StartTime = FPlatformTime::Seconds();
+    StartMemory = GetFMODCurrentMemory();
+}
+
+void FFMODBankLoadTimings::EndQueue()
+{
+    QueueTime = FPlatformTime::Seconds() - StartTime;
+}
+
+bool FFMODBankLoadTimings::UpdateLoadingState(FMOD::Studio::Bank *Bank)
+{
+    if (!bLoaded)
+    {
+        FMOD_STUDIO_LOADING_STATE LoadingState = FMOD_STUDIO_LOADING_STATE_ERROR;
+        if (Bank && Bank->getLoadingState(&LoadingState) == FMOD_OK && LoadingState == FMOD_STUDIO_LOADING_STATE_LOADING)
+        {
+            return false;
+        }
+
+        LoadTime = FPlatformTime::Seconds() - StartTime;
+        MemoryDelta = TakeFMODMemoryDelta(StartMemory);
+        bLoaded = true;
+    }
+    return true;
+}
+
+void FFMODBankLoadTimings::BeginSampleData()
+{
+    SampleDataStartTime = FPlatformTime::Seconds();
+    bSampleDataPending = true;
+}
+
+bool FFMODBankLoadTimings::UpdateSampleLoadingState(FMOD::Studio::Bank *Bank)
+{
+    if (bSampleDataPending)
+    {
+        FMOD_STUDIO_LOADING_STATE LoadingState = FMOD_STUDIO_LOADING_STATE_ERROR;
+        if (Bank && Bank->getSampleLoadingState(&LoadingState) == FMOD_OK && LoadingState == FMOD_STUDIO_LOADING_STATE_LOADING)
+        {
+            return false;
+        }
+
+        SampleDataTime = FPlatformTime::Seconds() - SampleDataStartTime;
+        MemoryDelta += TakeFMODMemoryDelta(StartMemory);
+        bSampleDataPending = false;
+    }
+    return true;
+}
+
+struct FFMODTrackedBankLoad
+{
+    FString Name;
+    FMOD::Studio::System *System;
+    FMOD::Studio::Bank *Bank;
+    FMOD_RESULT Result;
+    FFMODBankLoadTimings Timings;
+};
+
+// Only touched from the game thread
+static TArray<FFMODTrackedBankLoad> TrackedBankLoads;
+
+#if !UE_BUILD_SHIPPING
+static bool bBankLoadCsvStarted = false;
+
+// Rows for loads reported during the current tracking pass, written out together at the end of it
+static FString PendingBankLoadCsv;
+
+// Writes run in order on a background thread, so the file starts with its header and the game thread never waits
+static UE::Tasks::FPipe BankLoadCsvPipe(TEXT("FMODBankLoadCsv"));
+
+static void FlushFMODBankLoadCsv()
+{
+    if (PendingBankLoadCsv.IsEmpty())
+    {
+        return;
+    }
+
+    uint32 WriteFlags = FILEWRITE_Append;
+    if (!bBankLoadCsvStarted)
+    {
+        // Start a new file for each run so it begins with the startup loads
+        PendingBankLoadCsv.InsertAt(0, TEXT("Bank,QueueMs,LoadMs,SampleDataMs,MemoryDeltaBytes,Result\n"));
+        WriteFlags = FILEWRITE_None;
+        bBankLoadCsvStarted = true;
+    }
+
+    BankLoadCsvPipe.Launch(TEXT("FMODBankLoadCsvWrite"), [Csv = MoveTemp(PendingBankLoadCsv), WriteFlags]() {
+        FFileHelper::SaveStringToFile(Csv, *(FPaths::ProjectLogDir() / TEXT("FMODBankLoads.csv")),
+            FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), WriteFlags);
+    });
+    PendingBankLoadCsv.Reset();
+}
+#endif
+
+static void ReportFMODBankLoad(const FFMODTrackedBankLoad &Load)
+{
+    const FFMODBankLoadTimings &Timings = Load.Timings;
+
+    INC_DWORD_STAT(STAT_FMOD_Bank_Loads);
+    INC_FLOAT_STAT_BY(STAT_FMOD_Bank_QueueTime, Timings.QueueTime * 1000.0);
+    INC_FLOAT_STAT_BY(STAT_FMOD_Bank_LoadTime, Timings.LoadTime * 1000.0);
+    INC_FLOAT_STAT_BY(STAT_FMOD_Bank_SampleDataTime, Timings.SampleDataTime * 1000.0);
+    INC_MEMORY_STAT_BY(STAT_FMOD_Bank_MemoryDelta, FMath::Max<int64>(Timings.MemoryDelta, 0));
+
+    const FString BankName = FPaths::GetBaseFilename(Load.Name);
+    UE_LOG(LogFMOD, Verbose, TEXT("Bank %s: queue %.2fms, load %.2fms, sample data %.2fms, memory %+lld bytes"), *BankName,
+        Timings.QueueTime * 1000.0, Timings.LoadTime * 1000.0, Timings.SampleDataTime * 1000.0, Timings.MemoryDelta);
+
+#if !UE_BUILD_SHIPPING
+    PendingBankLoadCsv += FString::Printf(TEXT("%s,%.3f,%.3f,%.3f,%lld,%s\n"), *BankName, Timings.QueueTime * 1000.0, Timings.LoadTime * 1000.0,
+        Timings.SampleDataTime * 1000.0, Timings.MemoryDelta, UTF8_TO_TCHAR(FMOD_ErrorString(Load.Result)));
+#endif
+}
+
+void TrackFMODBankLoad(FMOD::Studio::System *System, const FString &Name, FMOD::Studio::Bank *Bank, FMOD_RESULT Result, const FFMODBankLoadTimings &Timings)
+{
+    FFMODTrackedBankLoad &Load = TrackedBankLoads.AddDefaulted_GetRef();
+    Load.Name = Name;
+    Load.System = System;
+    Load.Bank = (Result == FMOD_OK) ? Bank : nullptr;
+    Load.Result = Result;
+    Load.Timings = Timings;
+}
+
+void UpdateFMODBankLoadTracking()
+{
+    for (int32 i = 0; i < TrackedBankLoads.Num();)
+    {
+        FFMODTrackedBankLoad &Load = TrackedBankLoads[i];
+        if (Load.Bank && Load.Bank->isValid() &&
+            (!Load.Timings.UpdateLoadingState(Load.Bank) || !Load.Timings.UpdateSampleLoadingState(Load.Bank)))
+        {
+            ++i;
+            continue;
+        }
+
+        ReportFMODBankLoad(Load);
+        TrackedBankLoads.RemoveAtSwap(i);
+    }
+
+#if !UE_BUILD_SHIPPING
+    FlushFMODBankLoadCsv();
+#endif
+}
+
+void ResetFMODBankLoadTracking(FMOD::Studio::System *System)
+{
+    TrackedBankLoads.RemoveAll([System](const FFMODTrackedBankLoad &Load) { return Load.System == System; });
+}
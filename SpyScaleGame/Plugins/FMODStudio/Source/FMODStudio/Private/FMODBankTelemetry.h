@@ -0,0 +1,61 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "fmod_studio.hpp"
+#include "Containers/UnrealString.h"
+
+/**
+ * Timings for one bank load. Times are in seconds.
+ * MemoryDelta is the change in FMOD's allocated memory from queueing the load to the bank, and then its sample data,
+ * finishing loading, counted only from when the previous load finished so overlapping loads don't count the same growth.
+ * It also counts anything else FMOD allocated in that window.
+ */
+struct FFMODBankLoadTimings
+{
+    /** Time spent in the load call itself */
+    double QueueTime = 0.0;
+
+    /** Time from queueing the load to the bank leaving FMOD_STUDIO_LOADING_STATE_LOADING */
+    double LoadTime = 0.0;
+
+    /** Time from requesting sample data to it leaving FMOD_STUDIO_LOADING_STATE_LOADING */
+    double SampleDataTime = 0.0;
+
+    int64 MemoryDelta = 0;
+
+    /** Call immediately before loading the bank. */
+    void BeginQueue();
+
+    /** Call immediately after the load call returns. */
+    void EndQueue();
+
+    /** Record the load time once the bank has finished loading. Returns true when the bank is no longer loading. */
+    bool UpdateLoadingState(FMOD::Studio::Bank *Bank);
+
+    /** Call immediately after requesting the bank's sample data. */
+    void BeginSampleData();
+
+    /** Record the sample data time once loaded. Returns true when sample data is no longer loading. */
+    bool UpdateSampleLoadingState(FMOD::Studio::Bank *Bank);
+
+private:
+    double StartTime = 0.0;
+    double SampleDataStartTime = 0.0;
+    int64 StartMemory = 0;
+    bool bLoaded = false;
+    bool bSampleDataPending = false;
+};
+
+/**
+ * Hand a bank load over to be reported once it, and any requested sample data, has finished loading.
+ * Completed loads are reported from the next module tick: they update the FMOD bank stats and are appended together
+ * to FMODBankLoads.csv in the project log directory from a background task.
+ */
+void TrackFMODBankLoad(FMOD::Studio::System *System, const FString &Name, FMOD::Studio::Bank *Bank, FMOD_RESULT Result, const FFMODBankLoadTimings &Timings);
+
+/** Report tracked loads that have completed. Called from the module tick. */
+void UpdateFMODBankLoadTracking();
+
+/** Drop tracked loads for a Studio system that is being released. */
+void ResetFMODBankLoadTracking(FMOD::Studio::System *System);
@@ -2,6 +2,8 @@
 
 #include "FMODBlueprintStatics.h"
 #include "FMODAudioComponent.h"
+#include "FMODBankLoader.h"
+#include "FMODBankTelemetry.h"
 #include "FMODSettings.h"
 #include "FMODStudioModule.h"
 #include "FMODUtils.h"
@@ -12,6 +14,43 @@
 #include "fmod_studio.hpp"
 #include "fmod_errors.h"
 #include "FMODStudioPrivatePCH.h"
+#include "LatentActions.h"
+
+/** Latent action that waits for an asynchronous event lookup to complete */
+class FFMODFindEventAction : public FPendingLatentAction
+{
+public:
+    /** Shared with the lookup callback, which can outlive the action if the caller goes away */
+    struct FState
+    {
+        bool bDone = false;
+        TWeakObjectPtr<UFMODEvent> Event;
+    };
+
+    FFMODFindEventAction(UFMODEvent *&InEvent, const FLatentActionInfo &LatentInfo)
+        : Event(InEvent)
+        , State(MakeShared<FState, ESPMode::ThreadSafe>())
+        , ExecutionFunction(LatentInfo.ExecutionFunction)
+        , OutputLink(LatentInfo.Linkage)
+        , CallbackTarget(LatentInfo.CallbackTarget)
+    {
+    }
+
+    virtual void UpdateOperation(FLatentResponse &Response) override
+    {
+        if (State->bDone)
+        {
+            Event = State->Event.Get();
+        }
+        Response.FinishAndTriggerIf(State->bDone, ExecutionFunction, OutputLink, CallbackTarget);
+    }
+
+    UFMODEvent *&Event;
+    TSharedRef<FState, ESPMode::ThreadSafe> State;
+    FName ExecutionFunction;
+    int32 OutputLink;
+    FWeakObjectPtr CallbackTarget;
+};
 
 /////////////////////////////////////////////////////
 // UFMODBlueprintStatics
@@ -38,17 +77,48 @@ FFMODEventInstance UFMODBlueprintStatics::PlayEventAtLocation(
         FMOD::Studio::EventDescription *EventDesc = IFMODStudioModule::Get().GetEventDescription(Event);
         if (EventDesc != nullptr)
         {
-            FMOD::Studio::EventInstance *EventInst = nullptr;
-            EventDesc->createInstance(&EventInst);
+            IFMODStudioModule::Get().NotifyEventPlayed(Event);
+
+            // Fire-and-forget plays close to an earlier one join its instance instead of starting another
+            if (bAutoPlay)
+            {
+                Instance.Instance = IFMODStudioModule::Get().CoalesceOneshot(Event, Location.GetLocation());
+                if (Instance.Instance != nullptr)
+                {
+                    return Instance;
+                }
+            }
+
+            if (!IFMODStudioModule::Get().RequestVoice(Event, Location.GetLocation()))
+            {
+                return Instance;
+            }
+
+            // Fire-and-forget plays of oneshots reuse pooled instances, which are never released here
+            FMOD::Studio::EventInstance *EventInst = bAutoPlay ? IFMODStudioModule::Get().AcquirePooledInstance(Event) : nullptr;
+            const bool bPooled = (EventInst != nullptr);
+            if (!bPooled)
+            {
+                EventDesc->createInstance(&EventInst);
+            }
             if (EventInst != nullptr)
             {
                 FMOD_3D_ATTRIBUTES EventAttr = { { 0 } };
                 FMODUtils::Assign(EventAttr, Location);
                 EventInst->set3DAttributes(&EventAttr);
 
+                IFMODStudioModule::Get().TrackVoice(Event, EventInst);
+
                 if (bAutoPlay)
                 {
+                    IFMODStudioModule::Get().OpenCoalesceWindow(Event, Location.GetLocation(), EventInst);
                     EventInst->start();
+                    if (bPooled)
+                    {
+                        // The pool restarts the instance for later plays, so a handle kept by the caller could change or
+                        // stop an unrelated sound
+                        return Instance;
+                    }
                     EventInst->release();
                 }
                 Instance.Instance = EventInst;
@@ -132,6 +202,31 @@ UFMODEvent *UFMODBlueprintStatics::FindEventByName(const FString &Name)
     return IFMODStudioModule::Get().FindEventByName(Name);
 }
 
+void UFMODBlueprintStatics::FindEventByNameAsync(UObject *WorldContextObject, const FString &Name, UFMODEvent *&Event, FLatentActionInfo LatentInfo)
+{
+    UWorld *ThisWorld = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+    if (!ThisWorld)
+    {
+        return;
+    }
+
+    FLatentActionManager &LatentManager = ThisWorld->GetLatentActionManager();
+    if (LatentManager.FindExistingAction<FFMODFindEventAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) != nullptr)
+    {
+        return;
+    }
+
+    Event = nullptr;
+    FFMODFindEventAction *Action = new FFMODFindEventAction(Event, LatentInfo);
+    TSharedRef<FFMODFindEventAction::FState, ESPMode::ThreadSafe> State = Action->State;
+    LatentManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, Action);
+
+    IFMODStudioModule::Get().FindAssetByNameAsync(Name, IFMODStudioModule::FOnFMODAssetFound::CreateLambda([State](UFMODAsset *Asset) {
+        State->Event = Cast<UFMODEvent>(Asset);
+        State->bDone = true;
+    }));
+}
+
 void UFMODBlueprintStatics::LoadBank(class UFMODBank *Bank, bool bBlocking, bool bLoadSampleData)
 {
     FMOD::Studio::System *StudioSystem = IFMODStudioModule::Get().GetStudioSystem(EFMODSystemContext::Runtime);
@@ -143,7 +238,10 @@ void UFMODBlueprintStatics::LoadBank(class UFMODBank *Bank, bool bBlocking, bool
         FMOD::Studio::Bank *bank = nullptr;
         FMOD_STUDIO_LOAD_BANK_FLAGS flags = (bBlocking || bLoadSampleData) ? FMOD_STUDIO_LOAD_BANK_NORMAL : FMOD_STUDIO_LOAD_BANK_NONBLOCKING;
 
-        FMOD_RESULT result = StudioSystem->loadBankFile(TCHAR_TO_UTF8(*BankPath), flags, &bank);
+        FFMODBankLoadTimings Timings;
+        Timings.BeginQueue();
+        FMOD_RESULT result = LoadFMODBank(StudioSystem, BankPath, flags, &bank);
+        Timings.EndQueue();
         if (result != FMOD_OK)
         {
             UE_LOG(LogFMOD, Error, TEXT("Failed to load bank %s: %s"), *Bank->GetName(), UTF8_TO_TCHAR(FMOD_ErrorString(result)));
@@ -151,7 +249,9 @@ void UFMODBlueprintStatics::LoadBank(class UFMODBank *Bank, bool bBlocking, bool
         if (result == FMOD_OK && bLoadSampleData)
         {
             bank->loadSampleData();
+            Timings.BeginSampleData();
         }
+        TrackFMODBankLoad(StudioSystem, BankPath, bank, result, Timings);
     }
 }
 
@@ -670,3 +770,13 @@ void UFMODBlueprintStatics::SetLocale(const FString& Locale)
 {
     IFMODStudioModule::Get().SetLocale(Locale);
 }
+
+void UFMODBlueprintStatics::SwitchLocale(const FString& Locale)
+{
+    IFMODStudioModule::Get().SwitchLocale(Locale);
+}
+
+bool UFMODBlueprintStatics::IsSwitchingLocale()
+{
+    return IFMODStudioModule::Get().IsSwitchingLocale();
+}
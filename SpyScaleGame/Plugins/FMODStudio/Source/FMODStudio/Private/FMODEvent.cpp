@@ -2,6 +2,7 @@
 
 #include "FMODEvent.h"
 #include "FMODStudioModule.h"
+#include "FMODEventMetadata.h"
 #include "fmod_studio.hpp"
 
 UFMODEvent::UFMODEvent(const FObjectInitializer &ObjectInitializer)
@@ -15,17 +16,11 @@ void UFMODEvent::GetAssetRegistryTags(TArray<FAssetRegistryTag> &OutTags) const
     Super::GetAssetRegistryTags(OutTags);
     if (IFMODStudioModule::Get().AreBanksLoaded())
     {
-        FMOD::Studio::EventDescription *EventDesc = IFMODStudioModule::Get().GetEventDescription(this, EFMODSystemContext::Max);
+        TSharedPtr<const FFMODEventMetadata> Metadata = IFMODStudioModule::Get().GetEventMetadata(this, EFMODSystemContext::Max);
 
-        bool bOneshot = false;
-        bool bStream = false;
-        bool b3D = false;
-        if (EventDesc)
-        {
-            EventDesc->isOneshot(&bOneshot);
-            EventDesc->isStream(&bStream);
-            EventDesc->is3D(&b3D);
-        }
+        bool bOneshot = Metadata.IsValid() && Metadata->bIsOneshot;
+        bool bStream = Metadata.IsValid() && Metadata->bIsStream;
+        bool b3D = Metadata.IsValid() && Metadata->bIs3D;
 
         OutTags.Add(UObject::FAssetRegistryTag("Oneshot", bOneshot ? TEXT("True") : TEXT("False"), UObject::FAssetRegistryTag::TT_Alphabetical));
         OutTags.Add(UObject::FAssetRegistryTag("Streaming", bStream ? TEXT("True") : TEXT("False"), UObject::FAssetRegistryTag::TT_Alphabetical));
@@ -0,0 +1,250 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODEventInstancePool.h"
+#include "FMODEventMetadata.h"
+#include "FMODSettings.h"
+#include "FMODUtils.h"
+#include "fmod_studio.hpp"
+#include "FMODStudioPrivatePCH.h"
+#include "CoreGlobals.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FMOD Instance Pool - Instances"), STAT_FMOD_InstancePool_Instances, STATGROUP_FMOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD Instance Pool - Hits"), STAT_FMOD_InstancePool_Hits, STATGROUP_FMOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD Instance Pool - Misses"), STAT_FMOD_InstancePool_Misses, STATGROUP_FMOD);
+
+// How often pools are checked for idle instances
+static const double PoolUpdateInterval = 1.0;
+
+FFMODEventInstancePool::FFMODEventInstancePool()
+    : NextUpdateTime(0.0)
+    , HitCount(0)
+    , MissCount(0)
+{
+}
+
+bool FFMODEventInstancePool::IsEnabled() const
+{
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    return Settings.OneshotPoolSize > 0;
+}
+
+FFMODEventInstancePool::FPool &FFMODEventInstancePool::CreatePool(
+    const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FFMODEventMetadata &Metadata)
+{
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    FPool &Pool = Pools.Add(Guid);
+
+    // Only local game controlled parameters can be set on an instance
+    const FMOD_STUDIO_PARAMETER_FLAGS UnsettableFlags =
+        FMOD_STUDIO_PARAMETER_READONLY | FMOD_STUDIO_PARAMETER_AUTOMATIC | FMOD_STUDIO_PARAMETER_GLOBAL;
+    for (const FFMODEventParameterInfo &Parameter : Metadata.Parameters)
+    {
+        if (Parameter.Type == FMOD_STUDIO_PARAMETER_GAME_CONTROLLED && (Parameter.Flags & UnsettableFlags) == 0)
+        {
+            Pool.ParameterIds.Add(Parameter.Id);
+            Pool.DefaultValues.Add(Parameter.DefaultValue);
+        }
+    }
+
+    const int32 PrewarmCount = FMath::Min(Settings.OneshotPoolPrewarmCount, Settings.OneshotPoolSize);
+    for (int32 i = 0; i < PrewarmCount; ++i)
+    {
+        if (!AddInstance(Pool, Description))
+        {
+            break;
+        }
+    }
+
+    return Pool;
+}
+
+FMOD::Studio::EventInstance *FFMODEventInstancePool::AddInstance(FPool &Pool, FMOD::Studio::EventDescription *Description)
+{
+    FMOD::Studio::EventInstance *Instance = nullptr;
+    if (Description->createInstance(&Instance) != FMOD_OK)
+    {
+        return nullptr;
+    }
+
+    FPooledInstance &Pooled = Pool.Instances.AddDefaulted_GetRef();
+    Pooled.Instance = Instance;
+    Pooled.LastUsedTime = FPlatformTime::Seconds();
+    INC_DWORD_STAT(STAT_FMOD_InstancePool_Instances);
+    return Instance;
+}
+
+void FFMODEventInstancePool::ResetInstance(const FPool &Pool, FMOD::Studio::EventInstance *Instance)
+{
+    // Put everything a previous play could have changed back to how a new instance starts
+    if (Pool.ParameterIds.Num() > 0)
+    {
+        verifyfmod(Instance->setParametersByIDs(Pool.ParameterIds.GetData(), Pool.DefaultValues.GetData(), Pool.ParameterIds.Num(), true));
+    }
+    verifyfmod(Instance->setVolume(1.0f));
+    verifyfmod(Instance->setPitch(1.0f));
+    verifyfmod(Instance->setPaused(false));
+    verifyfmod(Instance->setListenerMask(0xFFFFFFFF));
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        verifyfmod(Instance->setReverbLevel(Index, 1.0f));
+    }
+    for (int32 Property = 0; Property < FMOD_STUDIO_EVENT_PROPERTY_MAX; ++Property)
+    {
+        // A value of -1 restores the property's default
+        verifyfmod(Instance->setProperty((FMOD_STUDIO_EVENT_PROPERTY)Property, -1.0f));
+    }
+    verifyfmod(Instance->setCallback(nullptr));
+    verifyfmod(Instance->setUserData(nullptr));
+}
+
+bool FFMODEventInstancePool::IsStopped(const FPooledInstance &Pooled)
+{
+    // Started too recently for the playback state to show it
+    if (Pooled.AcquiredFrame != 0 && GFrameCounter < Pooled.AcquiredFrame + 2)
+    {
+        return false;
+    }
+
+    FMOD_STUDIO_PLAYBACK_STATE State = FMOD_STUDIO_PLAYBACK_PLAYING;
+    return Pooled.Instance->getPlaybackState(&State) == FMOD_OK && State == FMOD_STUDIO_PLAYBACK_STOPPED;
+}
+
+void FFMODEventInstancePool::ReleaseInstance(FPooledInstance &Pooled)
+{
+    if (Pooled.Instance->isValid())
+    {
+        Pooled.Instance->release();
+    }
+    DEC_DWORD_STAT(STAT_FMOD_InstancePool_Instances);
+}
+
+FMOD::Studio::EventInstance *FFMODEventInstancePool::Acquire(
+    const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FFMODEventMetadata &Metadata)
+{
+    if (!Metadata.bIsOneshot || !Description)
+    {
+        return nullptr;
+    }
+
+    FPool *Pool = Pools.Find(Guid);
+    if (!Pool)
+    {
+        Pool = &CreatePool(Guid, Description, Metadata);
+    }
+
+    for (int32 i = 0; i < Pool->Instances.Num(); ++i)
+    {
+        FPooledInstance &Pooled = Pool->Instances[i];
+        FMOD::Studio::EventInstance *Instance = Pooled.Instance;
+
+        if (!Instance->isValid())
+        {
+            // Its bank was unloaded from outside the module
+            Pool->Instances.RemoveAtSwap(i--);
+            DEC_DWORD_STAT(STAT_FMOD_InstancePool_Instances);
+            continue;
+        }
+
+        if (IsStopped(Pooled))
+        {
+            ResetInstance(*Pool, Instance);
+
+            Pooled.AcquiredFrame = GFrameCounter;
+            Pooled.LastUsedTime = FPlatformTime::Seconds();
+            ++HitCount;
+            INC_DWORD_STAT(STAT_FMOD_InstancePool_Hits);
+            return Instance;
+        }
+    }
+
+    ++MissCount;
+    INC_DWORD_STAT(STAT_FMOD_InstancePool_Misses);
+
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    if (Pool->Instances.Num() >= Settings.OneshotPoolSize)
+    {
+        return nullptr;
+    }
+
+    FMOD::Studio::EventInstance *Instance = AddInstance(*Pool, Description);
+    if (Instance)
+    {
+        Pool->Instances.Last().AcquiredFrame = GFrameCounter;
+    }
+    return Instance;
+}
+
+void FFMODEventInstancePool::Update()
+{
+    if (Pools.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    if (Now < NextUpdateTime)
+    {
+        return;
+    }
+    NextUpdateTime = Now + PoolUpdateInterval;
+
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    const int32 PrewarmCount = FMath::Min(Settings.OneshotPoolPrewarmCount, Settings.OneshotPoolSize);
+
+    for (TPair<FGuid, FPool> &Pair : Pools)
+    {
+        TArray<FPooledInstance> &Instances = Pair.Value.Instances;
+        for (int32 i = Instances.Num() - 1; i >= 0 && Instances.Num() > PrewarmCount; --i)
+        {
+            FPooledInstance &Pooled = Instances[i];
+            if (Pooled.Instance->isValid() && (Now - Pooled.LastUsedTime < Settings.OneshotPoolIdleTime || !IsStopped(Pooled)))
+            {
+                continue;
+            }
+
+            ReleaseInstance(Pooled);
+            Instances.RemoveAtSwap(i);
+        }
+    }
+}
+
+int32 FFMODEventInstancePool::GetStoppedCount(const FGuid &Guid) const
+{
+    int32 Count = 0;
+    if (const FPool *Pool = Pools.Find(Guid))
+    {
+        for (const FPooledInstance &Pooled : Pool->Instances)
+        {
+            if (Pooled.Instance->isValid() && IsStopped(Pooled))
+            {
+                ++Count;
+            }
+        }
+    }
+    return Count;
+}
+
+void FFMODEventInstancePool::Release(const FGuid &Guid)
+{
+    FPool Pool;
+    if (Pools.RemoveAndCopyValue(Guid, Pool))
+    {
+        for (FPooledInstance &Pooled : Pool.Instances)
+        {
+            ReleaseInstance(Pooled);
+        }
+    }
+}
+
+void FFMODEventInstancePool::Reset()
+{
+    for (TPair<FGuid, FPool> &Pair : Pools)
+    {
+        for (FPooledInstance &Pooled : Pair.Value.Instances)
+        {
+            ReleaseInstance(Pooled);
+        }
+    }
+
+    Pools.Reset();
+}
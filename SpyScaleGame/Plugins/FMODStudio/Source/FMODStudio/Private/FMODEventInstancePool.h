@@ -0,0 +1,86 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "fmod_studio_common.h"
+
+namespace FMOD
+{
+namespace Studio
+{
+class EventDescription;
+class EventInstance;
+}
+}
+
+struct FFMODEventMetadata;
+
+/**
+ * Keeps up to OneshotPoolSize instances of each oneshot event alive so fire-and-forget plays can restart a stopped
+ * instance instead of creating and releasing one every time. Instances beyond OneshotPoolPrewarmCount are released
+ * once they have been unused for OneshotPoolIdleTime. Game thread only.
+ */
+class FFMODEventInstancePool
+{
+public:
+    FFMODEventInstancePool();
+
+    /** Whether a pool size is configured. When it is not, the pool does nothing. */
+    bool IsEnabled() const;
+
+    /**
+     * Get a stopped instance of the event with its parameters, properties, volume, pitch, reverb levels, listener mask,
+     * callback and user data back at their defaults, ready to start.
+     * The instance stays owned by the pool and must not be released. Returns null for events that aren't oneshots
+     * and when every pooled instance is still playing, in which case the caller creates its own instance.
+     */
+    FMOD::Studio::EventInstance *Acquire(const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FFMODEventMetadata &Metadata);
+
+    /** Release instances that have been idle for too long. Called from the module tick. */
+    void Update();
+
+    /** Number of the event's pooled instances that are stopped and waiting to be reused */
+    int32 GetStoppedCount(const FGuid &Guid) const;
+
+    /** Release the event's pooled instances, letting any that are playing finish. Used before its sample data is unloaded. */
+    void Release(const FGuid &Guid);
+
+    /** Release every pooled instance, letting any that are playing finish. Used before runtime banks are unloaded. */
+    void Reset();
+
+    uint64 GetHitCount() const { return HitCount; }
+    uint64 GetMissCount() const { return MissCount; }
+
+private:
+    struct FPooledInstance
+    {
+        FMOD::Studio::EventInstance *Instance = nullptr;
+
+        /** Frame the instance was last handed out, since its playback state only updates after Studio processes the start */
+        uint64 AcquiredFrame = 0;
+
+        /** Time the instance was created or last handed out */
+        double LastUsedTime = 0.0;
+    };
+
+    struct FPool
+    {
+        TArray<FPooledInstance> Instances;
+
+        /** Settable parameters and their defaults, applied when an instance is reused */
+        TArray<FMOD_STUDIO_PARAMETER_ID> ParameterIds;
+        TArray<float> DefaultValues;
+    };
+
+    FPool &CreatePool(const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FFMODEventMetadata &Metadata);
+    static FMOD::Studio::EventInstance *AddInstance(FPool &Pool, FMOD::Studio::EventDescription *Description);
+    static void ResetInstance(const FPool &Pool, FMOD::Studio::EventInstance *Instance);
+    static bool IsStopped(const FPooledInstance &Pooled);
+    static void ReleaseInstance(FPooledInstance &Pooled);
+
+    TMap<FGuid, FPool> Pools;
+    double NextUpdateTime;
+    uint64 HitCount;
+    uint64 MissCount;
+};
@@ -0,0 +1,86 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODEventMetadata.h"
+#include "FMODSettings.h"
+#include "fmod_studio.hpp"
+#include "FMODStudioPrivatePCH.h"
+
+TSharedRef<const FFMODEventMetadata> FFMODEventMetadata::Create(FMOD::Studio::EventDescription *Description)
+{
+    TSharedRef<FFMODEventMetadata> Metadata = MakeShared<FFMODEventMetadata>();
+
+    if (!Description)
+    {
+        return Metadata;
+    }
+
+    int Length = 0;
+    verifyfmod(Description->getLength(&Length));
+    Metadata->Length = Length;
+    verifyfmod(Description->is3D(&Metadata->bIs3D));
+    verifyfmod(Description->isOneshot(&Metadata->bIsOneshot));
+    verifyfmod(Description->isStream(&Metadata->bIsStream));
+
+    if (Metadata->bIs3D)
+    {
+        verifyfmod(Description->getMinMaxDistance(&Metadata->MinDistance, &Metadata->MaxDistance));
+    }
+
+    // FNames compare without case, the same way Studio matches parameter names
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    const FName OcclusionName = Settings.OcclusionParameter.IsEmpty() ? NAME_None : FName(*Settings.OcclusionParameter);
+    const FName AmbientVolumeName = Settings.AmbientVolumeParameter.IsEmpty() ? NAME_None : FName(*Settings.AmbientVolumeParameter);
+    const FName AmbientLPFName = Settings.AmbientLPFParameter.IsEmpty() ? NAME_None : FName(*Settings.AmbientLPFParameter);
+
+    int ParameterCount = 0;
+    verifyfmod(Description->getParameterDescriptionCount(&ParameterCount));
+    Metadata->Parameters.Reserve(ParameterCount);
+    Metadata->ParameterIndices.Reserve(ParameterCount);
+
+    for (int ParameterIndex = 0; ParameterIndex < ParameterCount; ++ParameterIndex)
+    {
+        FMOD_STUDIO_PARAMETER_DESCRIPTION ParameterDescription = {};
+        if (Description->getParameterDescriptionByIndex(ParameterIndex, &ParameterDescription) != FMOD_OK)
+        {
+            continue;
+        }
+
+        FFMODEventParameterInfo &Parameter = Metadata->Parameters.AddDefaulted_GetRef();
+        Parameter.Name = FName(UTF8_TO_TCHAR(ParameterDescription.name));
+        Parameter.Id = ParameterDescription.id;
+        Parameter.Type = ParameterDescription.type;
+        Parameter.Flags = ParameterDescription.flags;
+        Parameter.Minimum = ParameterDescription.minimum;
+        Parameter.Maximum = ParameterDescription.maximum;
+        Parameter.DefaultValue = ParameterDescription.defaultvalue;
+
+        if (!OcclusionName.IsNone() && Parameter.Name == OcclusionName)
+        {
+            Metadata->bHasOcclusionParameter = true;
+            Metadata->OcclusionParameterId = Parameter.Id;
+            Parameter.bBuiltIn = true;
+        }
+        else if (!AmbientVolumeName.IsNone() && Parameter.Name == AmbientVolumeName)
+        {
+            Metadata->bHasAmbientVolumeParameter = true;
+            Metadata->AmbientVolumeParameterId = Parameter.Id;
+            Parameter.bBuiltIn = true;
+        }
+        else if (!AmbientLPFName.IsNone() && Parameter.Name == AmbientLPFName)
+        {
+            Metadata->bHasAmbientLPFParameter = true;
+            Metadata->AmbientLPFParameterId = Parameter.Id;
+            Parameter.bBuiltIn = true;
+        }
+
+        Metadata->ParameterIndices.Add(Parameter.Name, Metadata->Parameters.Num() - 1);
+    }
+
+    return Metadata;
+}
+
+const FFMODEventParameterInfo *FFMODEventMetadata::FindParameter(const FName &Name) const
+{
+    const int32 *Index = ParameterIndices.Find(Name);
+    return Index ? &Parameters[*Index] : nullptr;
+}
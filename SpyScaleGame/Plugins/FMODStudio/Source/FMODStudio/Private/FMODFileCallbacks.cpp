@@ -4,12 +4,31 @@
 #include "fmod_errors.h"
 #include "FMODUtils.h"
 #include "HAL/FileManager.h"
+#include "FMODSettings.h"
+#include "Async/AsyncFileHandle.h"
 #include "GenericPlatform/GenericPlatformProcess.h"
-#include "HAL/Runnable.h"
-#include "HAL/RunnableThread.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/IQueuedWork.h"
+#include "Misc/QueuedThreadPool.h"
 #include "Misc/ScopeLock.h"
 #include "FMODStudioPrivatePCH.h"
 
+#include <atomic>
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FMOD File - Open Handles"), STAT_FMOD_File_OpenHandles, STATGROUP_FMOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD File - Reads"), STAT_FMOD_File_Reads, STATGROUP_FMOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD File - Seeks"), STAT_FMOD_File_Seeks, STATGROUP_FMOD);
+DECLARE_MEMORY_STAT(TEXT("FMOD File - Bytes Read"), STAT_FMOD_File_BytesRead, STATGROUP_FMOD);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("FMOD File - Queue Wait (ms)"), STAT_FMOD_File_QueueWait, STATGROUP_FMOD);
+DECLARE_CYCLE_STAT(TEXT("FMOD File - Read"), STAT_FMOD_File_Read, STATGROUP_FMOD);
+
+// Largest read a refill makes while holding the archive, so a foreground read that misses the ring waits for at most one chunk
+static const int32 ReadAheadChunkSize = 64 * 1024;
+
+const double FMODFileLatencyBucketLimitsMs[FMODFileLatencyBucketCount - 1] = { 0.1, 0.5, 1.0, 5.0, 10.0, 50.0 };
+
 FMOD_RESULT F_CALLBACK FMODLogCallback(FMOD_DEBUG_FLAGS flags, const char *file, int line, const char *func, const char *message)
 {
     if (flags & FMOD_DEBUG_LEVEL_ERROR)
@@ -59,11 +78,189 @@ FMOD_RESULT F_CALLBACK FMODErrorCallback(FMOD_SYSTEM *system, FMOD_SYSTEM_CALLBA
     return FMOD_OK;
 }
 
-class FFMODFileSystem : public FRunnable
+class FFMODReadAheadWork;
+
+/** Progress of one async read, shared by the thread issuing it, its completion callback and a cancel. Guarded by mAsyncCrit. */
+struct FFMODPendingRead
+{
+    // Null until ReadRequest has returned, and left null if it failed
+    IAsyncReadRequest *Request = nullptr;
+
+    // Set once ReadRequest has returned
+    bool bIssued = false;
+
+    // Set once info->done has returned, or when issuing failed and done will never be called
+    bool bDone = false;
+
+    // Set by a cancel waiting on the read, triggered whenever bIssued or bDone changes
+    FEvent *WakeEvent = nullptr;
+};
+
+/** Counters for one file path, shared by every handle opened on it. Records live until shutdown so handles can keep pointers to them. */
+struct FFMODFileStatsRecord
+{
+    FFMODFileStatsRecord(const FString &InName)
+        : Name(InName)
+    {
+        for (std::atomic<uint64> &Bucket : ReadLatency)
+        {
+            Bucket = 0;
+        }
+    }
+
+    void Reset()
+    {
+        OpenCount = 0;
+        BytesRead = 0;
+        ReadCount = 0;
+        SeekCount = 0;
+        QueueWaitCycles = 0;
+        for (std::atomic<uint64> &Bucket : ReadLatency)
+        {
+            Bucket = 0;
+        }
+    }
+
+    void RecordRead(uint64 Bytes, uint64 LatencyCycles)
+    {
+        BytesRead += Bytes;
+        ++ReadCount;
+
+        double LatencyMs = FPlatformTime::ToMilliseconds64(LatencyCycles);
+        int32 Bucket = 0;
+        while (Bucket < FMODFileLatencyBucketCount - 1 && LatencyMs >= FMODFileLatencyBucketLimitsMs[Bucket])
+        {
+            ++Bucket;
+        }
+        ++ReadLatency[Bucket];
+
+        INC_DWORD_STAT(STAT_FMOD_File_Reads);
+        INC_MEMORY_STAT_BY(STAT_FMOD_File_BytesRead, Bytes);
+    }
+
+    FString Name;
+    std::atomic<int32> OpenCount{ 0 };
+    std::atomic<int32> OpenHandles{ 0 };
+    std::atomic<uint64> BytesRead{ 0 };
+    std::atomic<uint64> ReadCount{ 0 };
+    std::atomic<uint64> SeekCount{ 0 };
+    std::atomic<uint64> QueueWaitCycles{ 0 };
+    std::atomic<uint64> ReadLatency[FMODFileLatencyBucketCount];
+};
+
+/** State for a single file opened by FMOD. Commands on one handle are serialized by its own lock only. */
+struct FFMODFileHandle
+{
+    FFMODFileHandle(FArchive *InArchive, int32 ReadAheadSize)
+        : Archive(InArchive)
+        , AsyncHandle(nullptr)
+        , FileSize(InArchive->TotalSize())
+        , Position(0)
+        , RingHead(0)
+        , RingStart(0)
+        , RingSize(0)
+        , Generation(0)
+        , RefillWork(nullptr)
+        , RefillIdleEvent(nullptr)
+        , Stats(nullptr)
+    {
+        if (ReadAheadSize > 0)
+        {
+            Ring.SetNumUninitialized(ReadAheadSize);
+            RefillChunk.SetNumUninitialized(FMath::Min(ReadAheadSize, ReadAheadChunkSize));
+            RefillIdleEvent = FGenericPlatformProcess::GetSynchEventFromPool(true);
+            RefillIdleEvent->Trigger();
+        }
+    }
+
+    FFMODFileHandle(IAsyncReadFileHandle *InAsyncHandle, int64 InFileSize)
+        : Archive(nullptr)
+        , AsyncHandle(InAsyncHandle)
+        , FileSize(InFileSize)
+        , Position(0)
+        , RingHead(0)
+        , RingStart(0)
+        , RingSize(0)
+        , Generation(0)
+        , RefillWork(nullptr)
+        , RefillIdleEvent(nullptr)
+        , Stats(nullptr)
+    {
+    }
+
+    ~FFMODFileHandle()
+    {
+        if (RefillIdleEvent)
+        {
+            FGenericPlatformProcess::ReturnSynchEventToPool(RefillIdleEvent);
+        }
+    }
+
+    // Used by synchronous file access
+    FArchive *Archive;
+
+    // Used by asynchronous file access
+    IAsyncReadFileHandle *AsyncHandle;
+
+    int64 FileSize;
+
+    // Read cursor as seen by FMOD
+    int64 Position;
+
+    // Read-ahead ring buffer, holding RingSize bytes of the file from offset RingStart, starting at index RingHead
+    TArray<uint8> Ring;
+    int32 RingHead;
+    int64 RingStart;
+    int32 RingSize;
+
+    // Bumped whenever the ring is discarded, so a refill started before a seek does not store stale data
+    uint32 Generation;
+    FFMODReadAheadWork *RefillWork;
+
+    // Staging buffer for refills, only used by the one refill a handle can have at a time
+    TArray<uint8> RefillChunk;
+    FEvent *RefillIdleEvent;
+
+    // Guards the cursor and the ring
+    FCriticalSection Crit;
+
+    // Guards the archive, which is shared between FMOD reads and background refills
+    FCriticalSection ArchiveCrit;
+
+    FFMODFileStatsRecord *Stats;
+};
+
+/** Tops up the read-ahead ring of a handle on the read-ahead thread. */
+class FFMODReadAheadWork : public IQueuedWork
 {
 public:
-    FFMODFileSystem()
-        : mHandleIn(nullptr)
+    FFMODReadAheadWork(FFMODFileHandle *InHandle)
+        : Handle(InHandle)
+    {
+    }
+
+    virtual void DoThreadedWork() override;
+    virtual void Abandon() override;
+
+    FFMODFileHandle *Handle;
+};
+
+/** A single file command, executed on one of the file system worker threads. */
+class FFMODFileCommand : public IQueuedWork
+{
+public:
+    enum Command
+    {
+        COMMAND_OPEN,
+        COMMAND_CLOSE,
+        COMMAND_READ,
+        COMMAND_SEEK,
+        COMMAND_MAX,
+    };
+
+    FFMODFileCommand(Command InCommand)
+        : mCommand(InCommand)
+        , mHandleIn(nullptr)
         , mName(nullptr)
         , mFileSize(nullptr)
         , mHandleOut(nullptr)
@@ -71,12 +268,52 @@ public:
         , mSizeBytes(0)
         , mBytesRead(nullptr)
         , mSeekPosition(0)
-        , mCommand(COMMAND_MAX)
         , mResult(FMOD_OK)
-        , mReferenceCount(0)
-        , mThread(nullptr)
-        , mCommandReadyEvent(nullptr)
-        , mCommandCompleteEvent(nullptr)
+        , mQueuedCycles(0)
+        , mStartedCycles(0)
+        , mStats(nullptr)
+        , mCompleteEvent(nullptr)
+    {
+    }
+
+    virtual void DoThreadedWork() override;
+    virtual void Abandon() override;
+
+    Command mCommand;
+
+    // Parameter for Close, Seek and Read
+    FFMODFileHandle *mHandleIn;
+
+    // Parameters for Open
+    const char *mName;
+    unsigned int *mFileSize;
+    void **mHandleOut;
+
+    // Parameters for Read
+    void *mBuffer;
+    unsigned int mSizeBytes;
+    unsigned int *mBytesRead;
+
+    // Parameter for Seek
+    unsigned int mSeekPosition;
+
+    FMOD_RESULT mResult;
+
+    // Timing, used to report how long each request waited for a worker
+    uint64 mQueuedCycles;
+    uint64 mStartedCycles;
+    FFMODFileStatsRecord *mStats;
+
+    FEvent *mCompleteEvent;
+};
+
+class FFMODFileSystem
+{
+public:
+    FFMODFileSystem()
+        : mReferenceCount(0)
+        , mThreadPool(nullptr)
+        , mReadAheadPool(nullptr)
     {
     }
 
@@ -85,10 +322,19 @@ public:
     static FMOD_RESULT F_CALLBACK ReadCallback(void *handle, void *buffer, unsigned int sizebytes, unsigned int *bytesread, void * /*userdata*/);
     static FMOD_RESULT F_CALLBACK SeekCallback(void *handle, unsigned int pos, void * /*userdata*/);
 
+    static FMOD_RESULT F_CALLBACK AsyncOpenCallback(const char *name, unsigned int *filesize, void **handle, void * /*userdata*/);
+    static FMOD_RESULT F_CALLBACK AsyncCloseCallback(void *handle, void * /*userdata*/);
+    static FMOD_RESULT F_CALLBACK AsyncReadCallback(FMOD_ASYNCREADINFO *info, void * /*userdata*/);
+    static FMOD_RESULT F_CALLBACK AsyncCancelCallback(FMOD_ASYNCREADINFO *info, void * /*userdata*/);
+
     static FMOD_RESULT OpenInternal(const char *name, unsigned int *filesize, void **handle);
-    static FMOD_RESULT CloseInternal(void *handle);
-    static FMOD_RESULT ReadInternal(void *handle, void *buffer, unsigned int sizebytes, unsigned int *bytesread);
-    static FMOD_RESULT SeekInternal(void *handle, unsigned int pos);
+    static FMOD_RESULT CloseInternal(FFMODFileHandle *handle);
+    static FMOD_RESULT ReadInternal(FFMODFileHandle *handle, void *buffer, unsigned int sizebytes, unsigned int *bytesread);
+    static FMOD_RESULT SeekInternal(FFMODFileHandle *handle, unsigned int pos);
+    static void RefillInternal(FFMODFileHandle *handle);
+
+    void QueueReadAhead(FFMODFileHandle *handle);
+    void CancelReadAhead(FFMODFileHandle *handle);
 
     void IncrementReferenceCount()
     {
@@ -98,11 +344,17 @@ public:
 
         if (mReferenceCount == 1)
         {
-            check(!mThread);
+            check(!mThreadPool);
 
-            mCommandReadyEvent = FGenericPlatformProcess::GetSynchEventFromPool();
-            mCommandCompleteEvent = FGenericPlatformProcess::GetSynchEventFromPool();
-            mThread = FRunnableThread::Create(this, TEXT("FMOD File Access Coordinator"));
+            const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+            int32 ThreadCount = FMath::Max(1, Settings.FileThreadCount);
+
+            mThreadPool = FQueuedThreadPool::Allocate();
+            verify(mThreadPool->Create(ThreadCount, 128 * 1024, TPri_AboveNormal, TEXT("FMOD File Access")));
+
+            // Refills get their own thread so they never hold up the blocking commands FMOD is waiting on
+            mReadAheadPool = FQueuedThreadPool::Allocate();
+            verify(mReadAheadPool->Create(1, 128 * 1024, TPri_BelowNormal, TEXT("FMOD File Read-Ahead")));
         }
     }
 
@@ -111,124 +363,279 @@ public:
         FScopeLock lock(&mCrit);
 
         check(mReferenceCount > 0);
-        check(mThread);
+        check(mThreadPool);
 
         --mReferenceCount;
 
         if (mReferenceCount == 0)
         {
-            verifyfmod(RunCommand(COMMAND_STOP));
-            mThread->WaitForCompletion();
+            // Waits for any outstanding commands to finish
+            mReadAheadPool->Destroy();
+            delete mReadAheadPool;
+            mReadAheadPool = nullptr;
+            mThreadPool->Destroy();
+            delete mThreadPool;
+            mThreadPool = nullptr;
 
-            FGenericPlatformProcess::ReturnSynchEventToPool(mCommandReadyEvent);
-            mCommandReadyEvent = nullptr;
-            FGenericPlatformProcess::ReturnSynchEventToPool(mCommandCompleteEvent);
-            mCommandCompleteEvent = nullptr;
-            delete mThread;
-            mThread = nullptr;
+            RetireCompletedReads();
         }
     }
 
     void Attach(FMOD::System *system, int32 fileBufferSize)
     {
-        check(mThread);
+        check(mThreadPool);
+
+        const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
 
-        verifyfmod(system->setFileSystem(OpenCallback, CloseCallback, ReadCallback, SeekCallback, 0, 0, fileBufferSize));
+        if (Settings.FileAccess == EFMODFileAccess::Asynchronous)
+        {
+            verifyfmod(system->setFileSystem(AsyncOpenCallback, AsyncCloseCallback, 0, 0, AsyncReadCallback, AsyncCancelCallback, fileBufferSize));
+        }
+        else
+        {
+            verifyfmod(system->setFileSystem(OpenCallback, CloseCallback, ReadCallback, SeekCallback, 0, 0, fileBufferSize));
+        }
     }
 
-    uint32 Run() override
+    FMOD_RESULT RunCommand(FFMODFileCommand &command)
     {
-        bool stopRequested = false;
+        check(mThreadPool);
+
+        command.mCompleteEvent = FGenericPlatformProcess::GetSynchEventFromPool();
+        command.mQueuedCycles = FPlatformTime::Cycles64();
+        mThreadPool->AddQueuedWork(&command);
+        command.mCompleteEvent->Wait();
+        FGenericPlatformProcess::ReturnSynchEventToPool(command.mCompleteEvent);
+        command.mCompleteEvent = nullptr;
 
-        while (!stopRequested)
+        RecordQueueWait(command.mStartedCycles - command.mQueuedCycles);
+        if (command.mStats)
         {
-            mCommandReadyEvent->Wait();
+            command.mStats->QueueWaitCycles += command.mStartedCycles - command.mQueuedCycles;
+        }
 
-            switch (mCommand)
-            {
-                case COMMAND_OPEN:
-                    mResult = OpenInternal(mName, mFileSize, mHandleOut);
-                    break;
-                case COMMAND_CLOSE:
-                    mResult = CloseInternal(mHandleIn);
-                    break;
-                case COMMAND_READ:
-                    mResult = ReadInternal(mHandleIn, mBuffer, mSizeBytes, mBytesRead);
-                    break;
-                case COMMAND_SEEK:
-                    mResult = SeekInternal(mHandleIn, mSeekPosition);
-                    break;
-                case COMMAND_STOP:
-                    stopRequested = true;
-                    mResult = FMOD_OK;
-                    break;
-            }
+        return command.mResult;
+    }
 
-            mCommandCompleteEvent->Trigger();
+    FFMODFileStatsRecord *OpenFileStats(const TCHAR *Name)
+    {
+        FScopeLock lock(&mStatsCrit);
+
+        TUniquePtr<FFMODFileStatsRecord> &Record = mFileStats.FindOrAdd(Name);
+        if (!Record)
+        {
+            Record = MakeUnique<FFMODFileStatsRecord>(Name);
         }
+        ++Record->OpenCount;
+        ++Record->OpenHandles;
+        INC_DWORD_STAT(STAT_FMOD_File_OpenHandles);
+        return Record.Get();
+    }
 
-        return 0;
+    void CloseFileStats(FFMODFileStatsRecord *Record)
+    {
+        if (Record)
+        {
+            --Record->OpenHandles;
+            DEC_DWORD_STAT(STAT_FMOD_File_OpenHandles);
+        }
     }
 
-private:
-    enum Command
+    TArray<FFMODFileStats> GetFileStats()
     {
-        COMMAND_OPEN,
-        COMMAND_CLOSE,
-        COMMAND_READ,
-        COMMAND_SEEK,
-        COMMAND_STOP,
-        COMMAND_MAX,
-    };
+        FScopeLock lock(&mStatsCrit);
 
-    FMOD_RESULT RunCommand(Command command)
+        TArray<FFMODFileStats> Result;
+        for (const TPair<FString, TUniquePtr<FFMODFileStatsRecord>> &Pair : mFileStats)
+        {
+            const FFMODFileStatsRecord &Record = *Pair.Value;
+            FFMODFileStats &Stats = Result.AddDefaulted_GetRef();
+            Stats.Name = Record.Name;
+            Stats.OpenCount = Record.OpenCount;
+            Stats.OpenHandles = Record.OpenHandles;
+            Stats.BytesRead = Record.BytesRead;
+            Stats.ReadCount = Record.ReadCount;
+            Stats.SeekCount = Record.SeekCount;
+            Stats.QueueWaitSeconds = FPlatformTime::ToSeconds64(Record.QueueWaitCycles);
+            for (int32 i = 0; i < FMODFileLatencyBucketCount; ++i)
+            {
+                Stats.ReadLatency[i] = Record.ReadLatency[i];
+            }
+        }
+        return Result;
+    }
+
+    void ResetFileStats()
     {
-        check(mThread);
+        FScopeLock lock(&mStatsCrit);
 
-        mCommand = command;
-        mCommandReadyEvent->Trigger();
-        mCommandCompleteEvent->Wait();
+        for (TPair<FString, TUniquePtr<FFMODFileStatsRecord>> &Pair : mFileStats)
+        {
+            Pair.Value->Reset();
+        }
+    }
 
-        return mResult;
+    FFMODFileSystemStats GetStats() const
+    {
+        FFMODFileSystemStats Stats;
+        Stats.RequestCount = mRequestCount.load();
+        Stats.TotalQueueWaitSeconds = FPlatformTime::ToSeconds64(mTotalQueueWaitCycles.load());
+        Stats.MaxQueueWaitSeconds = FPlatformTime::ToSeconds64(mMaxQueueWaitCycles.load());
+        Stats.ReadAheadHits = mReadAheadHits.load();
+        Stats.ReadAheadMisses = mReadAheadMisses.load();
+        return Stats;
     }
 
-    // Parameter for Close, Seek and Read
-    void *mHandleIn;
+private:
+    /**
+     * Called with mAsyncCrit held after a pending read changes. Once the read has been issued and completed, and no cancel is
+     * waiting on it, its state is freed and the request is queued for deletion.
+     */
+    void FinishPendingRead(FMOD_ASYNCREADINFO *info, FFMODPendingRead *Pending)
+    {
+        if (Pending->WakeEvent)
+        {
+            Pending->WakeEvent->Trigger();
+            return;
+        }
+        if (!Pending->bIssued || !Pending->bDone)
+        {
+            return;
+        }
 
-    // Parameters for Open
-    const char *mName;
-    unsigned int *mFileSize;
-    void **mHandleOut;
+        // FMOD may already have reused the info for a new read once done returned
+        FFMODPendingRead **Current = mPendingReads.Find(info);
+        if (Current && *Current == Pending)
+        {
+            mPendingReads.Remove(info);
+        }
+        if (Pending->Request)
+        {
+            mCompletedReads.Add(Pending->Request);
+        }
+        delete Pending;
+    }
 
-    // Parameters for Read
-    void *mBuffer;
-    unsigned int mSizeBytes;
-    unsigned int *mBytesRead;
+    /** Deletes async requests whose completion callbacks have run. Requests cannot delete themselves from inside their own callback. */
+    void RetireCompletedReads()
+    {
+        TArray<IAsyncReadRequest *> Retired;
+        {
+            FScopeLock lock(&mAsyncCrit);
+            Retired = MoveTemp(mCompletedReads);
+        }
 
-    // Parameter for Seek
-    unsigned int mSeekPosition;
+        for (IAsyncReadRequest *Request : Retired)
+        {
+            Request->WaitCompletion();
+            delete Request;
+        }
+    }
 
-    Command mCommand;
-    FMOD_RESULT mResult;
+    void RecordQueueWait(uint64 WaitCycles)
+    {
+        ++mRequestCount;
+        mTotalQueueWaitCycles += WaitCycles;
+
+        uint64 PreviousMax = mMaxQueueWaitCycles.load();
+        while (WaitCycles > PreviousMax && !mMaxQueueWaitCycles.compare_exchange_weak(PreviousMax, WaitCycles))
+        {
+        }
+
+        INC_FLOAT_STAT_BY(STAT_FMOD_File_QueueWait, (float)FPlatformTime::ToMilliseconds64(WaitCycles));
+        UE_LOG(LogFMOD, VeryVerbose, TEXT("FFMODFileSystem request waited %.3f ms for a worker"), FPlatformTime::ToMilliseconds64(WaitCycles));
+    }
 
     int mReferenceCount;
-    FRunnableThread *mThread;
-    FEvent *mCommandReadyEvent;
-    FEvent *mCommandCompleteEvent;
+    FQueuedThreadPool *mThreadPool;
+    FQueuedThreadPool *mReadAheadPool;
 
+    // Only guards creation and destruction of the thread pool, never taken on the read path
     FCriticalSection mCrit;
+
+    // Async reads whose done callback has not returned yet, keyed by the FMOD request
+    TMap<FMOD_ASYNCREADINFO *, FFMODPendingRead *> mPendingReads;
+    TArray<IAsyncReadRequest *> mCompletedReads;
+    FCriticalSection mAsyncCrit;
+
+    std::atomic<uint64> mRequestCount{ 0 };
+    std::atomic<uint64> mTotalQueueWaitCycles{ 0 };
+    std::atomic<uint64> mMaxQueueWaitCycles{ 0 };
+    std::atomic<uint64> mReadAheadHits{ 0 };
+    std::atomic<uint64> mReadAheadMisses{ 0 };
+
+    // Per file counters, keyed by the path FMOD opened
+    TMap<FString, TUniquePtr<FFMODFileStatsRecord>> mFileStats;
+    FCriticalSection mStatsCrit;
 };
 
 static FFMODFileSystem gFileSystem;
 
+void FFMODFileCommand::DoThreadedWork()
+{
+    mStartedCycles = FPlatformTime::Cycles64();
+    if (mHandleIn)
+    {
+        mStats = mHandleIn->Stats;
+    }
+
+    switch (mCommand)
+    {
+        case COMMAND_OPEN:
+            mResult = FFMODFileSystem::OpenInternal(mName, mFileSize, mHandleOut);
+            if (mResult == FMOD_OK && *mHandleOut)
+            {
+                mStats = ((FFMODFileHandle *)*mHandleOut)->Stats;
+            }
+            break;
+        case COMMAND_CLOSE:
+            mResult = FFMODFileSystem::CloseInternal(mHandleIn);
+            break;
+        case COMMAND_READ:
+            mResult = FFMODFileSystem::ReadInternal(mHandleIn, mBuffer, mSizeBytes, mBytesRead);
+            break;
+        case COMMAND_SEEK:
+            mResult = FFMODFileSystem::SeekInternal(mHandleIn, mSeekPosition);
+            break;
+        default:
+            mResult = FMOD_ERR_INTERNAL;
+            break;
+    }
+
+    mCompleteEvent->Trigger();
+}
+
+void FFMODReadAheadWork::DoThreadedWork()
+{
+    FFMODFileSystem::RefillInternal(Handle);
+    delete this;
+}
+
+void FFMODReadAheadWork::Abandon()
+{
+    {
+        FScopeLock lock(&Handle->Crit);
+        Handle->RefillWork = nullptr;
+        Handle->RefillIdleEvent->Trigger();
+    }
+    delete this;
+}
+
+void FFMODFileCommand::Abandon()
+{
+    mStartedCycles = FPlatformTime::Cycles64();
+    mResult = FMOD_ERR_FILE_BAD;
+    mCompleteEvent->Trigger();
+}
+
 FMOD_RESULT F_CALLBACK FFMODFileSystem::OpenCallback(const char *name, unsigned int *filesize, void **handle, void * /*userdata*/)
 {
-    FScopeLock lock(&gFileSystem.mCrit);
-    gFileSystem.mName = name;
-    gFileSystem.mFileSize = filesize;
-    gFileSystem.mHandleOut = handle;
+    FFMODFileCommand Command(FFMODFileCommand::COMMAND_OPEN);
+    Command.mName = name;
+    Command.mFileSize = filesize;
+    Command.mHandleOut = handle;
 
-    return gFileSystem.RunCommand(COMMAND_OPEN);
+    return gFileSystem.RunCommand(Command);
 }
 
 FMOD_RESULT FFMODFileSystem::OpenInternal(const char *name, unsigned int *filesize, void **handle)
@@ -241,8 +648,11 @@ FMOD_RESULT FFMODFileSystem::OpenInternal(const char *name, unsigned int *filesi
         {
             return FMOD_ERR_FILE_NOTFOUND;
         }
+        const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
         *filesize = Archive->TotalSize();
-        *handle = Archive;
+        FFMODFileHandle *FileHandle = new FFMODFileHandle(Archive, Settings.FileReadAheadSize);
+        FileHandle->Stats = gFileSystem.OpenFileStats(UTF8_TO_TCHAR(name));
+        *handle = FileHandle;
         UE_LOG(LogFMOD, Verbose, TEXT("  TotalSize = %d"), *filesize);
     }
 
@@ -251,38 +661,44 @@ FMOD_RESULT FFMODFileSystem::OpenInternal(const char *name, unsigned int *filesi
 
 FMOD_RESULT F_CALLBACK FFMODFileSystem::CloseCallback(void *handle, void * /*userdata*/)
 {
-    FScopeLock lock(&gFileSystem.mCrit);
-    gFileSystem.mHandleIn = handle;
+    FFMODFileCommand Command(FFMODFileCommand::COMMAND_CLOSE);
+    Command.mHandleIn = (FFMODFileHandle *)handle;
 
-    return gFileSystem.RunCommand(COMMAND_CLOSE);
+    return gFileSystem.RunCommand(Command);
 }
 
-FMOD_RESULT FFMODFileSystem::CloseInternal(void *handle)
+FMOD_RESULT FFMODFileSystem::CloseInternal(FFMODFileHandle *handle)
 {
     if (!handle)
     {
         return FMOD_ERR_INVALID_PARAM;
     }
 
-    FArchive *Archive = (FArchive *)handle;
-    UE_LOG(LogFMOD, Verbose, TEXT("FFMODFileSystem::CloseCallback closing archive %p"), Archive);
-    delete Archive;
+    UE_LOG(LogFMOD, Verbose, TEXT("FFMODFileSystem::CloseCallback closing archive %p"), handle->Archive);
+    gFileSystem.CancelReadAhead(handle);
+    gFileSystem.CloseFileStats(handle->Stats);
+    {
+        FScopeLock lock(&handle->ArchiveCrit);
+        delete handle->Archive;
+        handle->Archive = nullptr;
+    }
+    delete handle;
 
     return FMOD_OK;
 }
 
 FMOD_RESULT F_CALLBACK FFMODFileSystem::ReadCallback(void *handle, void *buffer, unsigned int sizebytes, unsigned int *bytesread, void * /*userdata*/)
 {
-    FScopeLock lock(&gFileSystem.mCrit);
-    gFileSystem.mHandleIn = handle;
-    gFileSystem.mBuffer = buffer;
-    gFileSystem.mSizeBytes = sizebytes;
-    gFileSystem.mBytesRead = bytesread;
+    FFMODFileCommand Command(FFMODFileCommand::COMMAND_READ);
+    Command.mHandleIn = (FFMODFileHandle *)handle;
+    Command.mBuffer = buffer;
+    Command.mSizeBytes = sizebytes;
+    Command.mBytesRead = bytesread;
 
-    return gFileSystem.RunCommand(COMMAND_READ);
+    return gFileSystem.RunCommand(Command);
 }
 
-FMOD_RESULT FFMODFileSystem::ReadInternal(void *handle, void *buffer, unsigned int sizebytes, unsigned int *bytesread)
+FMOD_RESULT FFMODFileSystem::ReadInternal(FFMODFileHandle *handle, void *buffer, unsigned int sizebytes, unsigned int *bytesread)
 {
     if (!handle)
     {
@@ -291,13 +707,90 @@ FMOD_RESULT FFMODFileSystem::ReadInternal(void *handle, void *buffer, unsigned i
 
     if (bytesread)
     {
-        FArchive *Archive = (FArchive *)handle;
+        SCOPE_CYCLE_COUNTER(STAT_FMOD_File_Read);
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        FScopeLock lock(&handle->Crit);
+
+        int64 BytesLeft = handle->FileSize - handle->Position;
+        int64 ReadAmount = FMath::Clamp((int64)sizebytes, (int64)0, BytesLeft);
+        uint8 *Dest = (uint8 *)buffer;
+        int64 Served = 0;
+
+        if (handle->Ring.Num() > 0)
+        {
+            const int32 Capacity = handle->Ring.Num();
+
+            if (handle->Position >= handle->RingStart && handle->Position <= handle->RingStart + handle->RingSize)
+            {
+                // Drop anything behind the cursor, then copy out of the ring
+                int32 Skip = (int32)(handle->Position - handle->RingStart);
+                handle->RingHead = (handle->RingHead + Skip) % Capacity;
+                handle->RingStart += Skip;
+                handle->RingSize -= Skip;
+
+                Served = FMath::Min(ReadAmount, (int64)handle->RingSize);
+                int32 FirstPart = FMath::Min((int32)Served, Capacity - handle->RingHead);
+                FMemory::Memcpy(Dest, handle->Ring.GetData() + handle->RingHead, FirstPart);
+                FMemory::Memcpy(Dest + FirstPart, handle->Ring.GetData(), Served - FirstPart);
+
+                handle->RingHead = (handle->RingHead + (int32)Served) % Capacity;
+                handle->RingStart += Served;
+                handle->RingSize -= (int32)Served;
+            }
+            else
+            {
+                // The cursor left the ring, so restart read-ahead from here
+                ++handle->Generation;
+                handle->RingHead = 0;
+                handle->RingStart = handle->Position;
+                handle->RingSize = 0;
+            }
 
-        int64 BytesLeft = Archive->TotalSize() - Archive->Tell();
-        int64 ReadAmount = FMath::Min((int64)sizebytes, BytesLeft);
+            if (Served == ReadAmount)
+            {
+                ++gFileSystem.mReadAheadHits;
+            }
+            else
+            {
+                ++gFileSystem.mReadAheadMisses;
+            }
+        }
+
+        if (Served < ReadAmount)
+        {
+            FScopeLock archiveLock(&handle->ArchiveCrit);
+            FArchive *Archive = handle->Archive;
+
+            int64 Offset = handle->Position + Served;
+            if (Archive->Tell() != Offset)
+            {
+                Archive->Seek(Offset);
+            }
+            Archive->Serialize(Dest + Served, ReadAmount - Served);
+
+            if (handle->Ring.Num() > 0)
+            {
+                // Data read directly is behind the cursor, so the ring restarts after it
+                ++handle->Generation;
+                handle->RingHead = 0;
+                handle->RingStart = Offset + (ReadAmount - Served);
+                handle->RingSize = 0;
+            }
+        }
+
+        handle->Position += ReadAmount;
+
+        if (handle->Ring.Num() > 0 && !handle->RefillWork && handle->RingSize <= handle->Ring.Num() / 2
+            && handle->RingStart + handle->RingSize < handle->FileSize)
+        {
+            gFileSystem.QueueReadAhead(handle);
+        }
 
-        Archive->Serialize(buffer, ReadAmount);
         *bytesread = (unsigned int)ReadAmount;
+        if (handle->Stats)
+        {
+            handle->Stats->RecordRead(ReadAmount, FPlatformTime::Cycles64() - StartCycles);
+        }
         if (ReadAmount < (int64)sizebytes)
         {
             UE_LOG(LogFMOD, Verbose, TEXT(" -> EOF "));
@@ -310,26 +803,301 @@ FMOD_RESULT FFMODFileSystem::ReadInternal(void *handle, void *buffer, unsigned i
 
 FMOD_RESULT F_CALLBACK FFMODFileSystem::SeekCallback(void *handle, unsigned int pos, void * /*userdata*/)
 {
-    FScopeLock lock(&gFileSystem.mCrit);
-    gFileSystem.mHandleIn = handle;
-    gFileSystem.mSeekPosition = pos;
+    FFMODFileCommand Command(FFMODFileCommand::COMMAND_SEEK);
+    Command.mHandleIn = (FFMODFileHandle *)handle;
+    Command.mSeekPosition = pos;
 
-    return gFileSystem.RunCommand(COMMAND_SEEK);
+    return gFileSystem.RunCommand(Command);
 }
 
-FMOD_RESULT FFMODFileSystem::SeekInternal(void *handle, unsigned int pos)
+FMOD_RESULT FFMODFileSystem::SeekInternal(FFMODFileHandle *handle, unsigned int pos)
 {
     if (!handle)
     {
         return FMOD_ERR_INVALID_PARAM;
     }
 
-    FArchive *Archive = (FArchive *)handle;
-    Archive->Seek(pos);
+    // The archive is only repositioned when a read misses the read-ahead ring
+    FScopeLock lock(&handle->Crit);
+    handle->Position = pos;
+
+    if (handle->Stats)
+    {
+        ++handle->Stats->SeekCount;
+        INC_DWORD_STAT(STAT_FMOD_File_Seeks);
+    }
 
     return FMOD_OK;
 }
 
+void FFMODFileSystem::QueueReadAhead(FFMODFileHandle *handle)
+{
+    // Called with handle->Crit held
+    check(mReadAheadPool);
+
+    handle->RefillWork = new FFMODReadAheadWork(handle);
+    handle->RefillIdleEvent->Reset();
+    mReadAheadPool->AddQueuedWork(handle->RefillWork, EQueuedWorkPriority::Low);
+}
+
+void FFMODFileSystem::CancelReadAhead(FFMODFileHandle *handle)
+{
+    if (handle->Ring.Num() == 0)
+    {
+        return;
+    }
+
+    {
+        FScopeLock lock(&handle->Crit);
+        ++handle->Generation;
+
+        // Pull a refill that has not started rather than waiting for the read-ahead thread to reach it
+        if (handle->RefillWork && mReadAheadPool->RetractQueuedWork(handle->RefillWork))
+        {
+            delete handle->RefillWork;
+            handle->RefillWork = nullptr;
+            handle->RefillIdleEvent->Trigger();
+        }
+    }
+
+    handle->RefillIdleEvent->Wait();
+}
+
+void FFMODFileSystem::RefillInternal(FFMODFileHandle *handle)
+{
+    // Fill the ring a chunk at a time, letting foreground reads take the archive in between
+    for (;;)
+    {
+        int64 Offset;
+        int32 Space;
+        uint32 Generation;
+        {
+            FScopeLock lock(&handle->Crit);
+            Offset = handle->RingStart + handle->RingSize;
+            Space = (int32)FMath::Min((int64)(handle->Ring.Num() - handle->RingSize), handle->FileSize - Offset);
+            Space = FMath::Min(Space, handle->RefillChunk.Num());
+            Generation = handle->Generation;
+
+            if (Space <= 0)
+            {
+                handle->RefillWork = nullptr;
+                handle->RefillIdleEvent->Trigger();
+                return;
+            }
+        }
+
+        {
+            FScopeLock archiveLock(&handle->ArchiveCrit);
+            FArchive *Archive = handle->Archive;
+            if (Archive->Tell() != Offset)
+            {
+                Archive->Seek(Offset);
+            }
+            Archive->Serialize(handle->RefillChunk.GetData(), Space);
+        }
+
+        FScopeLock lock(&handle->Crit);
+        if (Generation != handle->Generation || Offset != handle->RingStart + handle->RingSize)
+        {
+            // The cursor moved while reading, the next read will start a new refill from there
+            handle->RefillWork = nullptr;
+            handle->RefillIdleEvent->Trigger();
+            return;
+        }
+
+        const int32 Capacity = handle->Ring.Num();
+        int32 Store = FMath::Min(Space, Capacity - handle->RingSize);
+        int32 Tail = (handle->RingHead + handle->RingSize) % Capacity;
+        int32 FirstPart = FMath::Min(Store, Capacity - Tail);
+        FMemory::Memcpy(handle->Ring.GetData() + Tail, handle->RefillChunk.GetData(), FirstPart);
+        FMemory::Memcpy(handle->Ring.GetData(), handle->RefillChunk.GetData() + FirstPart, Store - FirstPart);
+        handle->RingSize += Store;
+    }
+}
+
+FMOD_RESULT F_CALLBACK FFMODFileSystem::AsyncOpenCallback(const char *name, unsigned int *filesize, void **handle, void * /*userdata*/)
+{
+    if (name)
+    {
+        const TCHAR *FileName = UTF8_TO_TCHAR(name);
+        int64 FileSize = IFileManager::Get().FileSize(FileName);
+        if (FileSize < 0)
+        {
+            return FMOD_ERR_FILE_NOTFOUND;
+        }
+
+        IAsyncReadFileHandle *AsyncHandle = FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(FileName);
+        UE_LOG(LogFMOD, Verbose, TEXT("FFMODFileSystem::AsyncOpenCallback opening '%s' returned async handle %p"), FileName, AsyncHandle);
+        if (!AsyncHandle)
+        {
+            return FMOD_ERR_FILE_NOTFOUND;
+        }
+        *filesize = (unsigned int)FileSize;
+        FFMODFileHandle *FileHandle = new FFMODFileHandle(AsyncHandle, FileSize);
+        FileHandle->Stats = gFileSystem.OpenFileStats(FileName);
+        *handle = FileHandle;
+    }
+
+    return FMOD_OK;
+}
+
+FMOD_RESULT F_CALLBACK FFMODFileSystem::AsyncCloseCallback(void *handle, void * /*userdata*/)
+{
+    FFMODFileHandle *FileHandle = (FFMODFileHandle *)handle;
+    if (!FileHandle)
+    {
+        return FMOD_ERR_INVALID_PARAM;
+    }
+
+    UE_LOG(LogFMOD, Verbose, TEXT("FFMODFileSystem::AsyncCloseCallback closing async handle %p"), FileHandle->AsyncHandle);
+
+    // All requests must be deleted before the handle that issued them
+    gFileSystem.RetireCompletedReads();
+    gFileSystem.CloseFileStats(FileHandle->Stats);
+    delete FileHandle->AsyncHandle;
+    delete FileHandle;
+
+    return FMOD_OK;
+}
+
+FMOD_RESULT F_CALLBACK FFMODFileSystem::AsyncReadCallback(FMOD_ASYNCREADINFO *info, void * /*userdata*/)
+{
+    FFMODFileHandle *FileHandle = (FFMODFileHandle *)info->handle;
+    if (!FileHandle || !FileHandle->AsyncHandle)
+    {
+        return FMOD_ERR_INVALID_PARAM;
+    }
+
+    gFileSystem.RetireCompletedReads();
+
+    int64 BytesLeft = FileHandle->FileSize - (int64)info->offset;
+    int64 ReadAmount = FMath::Clamp((int64)info->sizebytes, (int64)0, BytesLeft);
+    if (ReadAmount <= 0)
+    {
+        info->bytesread = 0;
+        info->done(info, FMOD_ERR_FILE_EOF);
+        return FMOD_OK;
+    }
+
+    // Stream refills are issued with a high priority, bank and sample data loads with a low one
+    EAsyncIOPriorityAndFlags Priority = AIOP_Normal;
+    if (info->priority >= 75)
+    {
+        Priority = AIOP_High;
+    }
+    else if (info->priority < 25)
+    {
+        Priority = AIOP_Low;
+    }
+
+    FFMODFileStatsRecord *Stats = FileHandle->Stats;
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    FFMODPendingRead *Pending = new FFMODPendingRead;
+
+    // The pending read is only marked done once done has returned, so a cancel until then waits rather than letting FMOD
+    // free the info and its buffer under the callback
+    FAsyncFileCallBack Callback = [info, Pending, ReadAmount, Stats, StartCycles](bool bWasCancelled, IAsyncReadRequest * /*Request*/)
+    {
+        if (bWasCancelled)
+        {
+            info->bytesread = 0;
+            info->done(info, FMOD_ERR_FILE_DISKEJECTED);
+        }
+        else
+        {
+            // The platform gives no start time for an async read, so the whole time from issue to completion counts as
+            // queue wait, which is what FMOD spends waiting on the request
+            const uint64 WaitCycles = FPlatformTime::Cycles64() - StartCycles;
+            gFileSystem.RecordQueueWait(WaitCycles);
+            if (Stats)
+            {
+                Stats->QueueWaitCycles += WaitCycles;
+                Stats->RecordRead(ReadAmount, WaitCycles);
+            }
+            info->bytesread = (unsigned int)ReadAmount;
+            info->done(info, ReadAmount < (int64)info->sizebytes ? FMOD_ERR_FILE_EOF : FMOD_OK);
+        }
+
+        FScopeLock lock(&gFileSystem.mAsyncCrit);
+        Pending->bDone = true;
+        gFileSystem.FinishPendingRead(info, Pending);
+    };
+
+    {
+        FScopeLock lock(&gFileSystem.mAsyncCrit);
+        gFileSystem.mPendingReads.Add(info, Pending);
+    }
+
+    // The request may complete before this returns, in which case the pending read is finished once it is stored
+    IAsyncReadRequest *Request = FileHandle->AsyncHandle->ReadRequest(info->offset, ReadAmount, Priority, &Callback, (uint8 *)info->buffer);
+
+    FScopeLock lock(&gFileSystem.mAsyncCrit);
+    Pending->Request = Request;
+    Pending->bIssued = true;
+    if (!Request)
+    {
+        Pending->bDone = true;
+    }
+    gFileSystem.FinishPendingRead(info, Pending);
+
+    return Request ? FMOD_OK : FMOD_ERR_FILE_BAD;
+}
+
+FMOD_RESULT F_CALLBACK FFMODFileSystem::AsyncCancelCallback(FMOD_ASYNCREADINFO *info, void * /*userdata*/)
+{
+    FFMODPendingRead *Pending = nullptr;
+    FEvent *WakeEvent = nullptr;
+    {
+        FScopeLock lock(&gFileSystem.mAsyncCrit);
+        FFMODPendingRead **Found = gFileSystem.mPendingReads.Find(info);
+        if (!Found || (*Found)->bDone)
+        {
+            // Already complete
+            return FMOD_OK;
+        }
+
+        // Holding the wake event keeps the pending read, and its request, alive until this cancel lets go of it
+        Pending = *Found;
+        WakeEvent = FGenericPlatformProcess::GetSynchEventFromPool();
+        Pending->WakeEvent = WakeEvent;
+    }
+
+    // FMOD may free the buffer as soon as this returns, so wait for the request to be issued, cancel it, and wait for
+    // its callback to finish with the buffer
+    bool bCancelled = false;
+    for (;;)
+    {
+        IAsyncReadRequest *Request = nullptr;
+        {
+            FScopeLock lock(&gFileSystem.mAsyncCrit);
+            if (Pending->bIssued && Pending->bDone)
+            {
+                Pending->WakeEvent = nullptr;
+                gFileSystem.FinishPendingRead(info, Pending);
+                break;
+            }
+            if (Pending->Request && !bCancelled)
+            {
+                Request = Pending->Request;
+                bCancelled = true;
+            }
+        }
+
+        if (Request)
+        {
+            Request->Cancel();
+        }
+        else
+        {
+            WakeEvent->Wait();
+        }
+    }
+
+    FGenericPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+    return FMOD_OK;
+}
+
 void AcquireFMODFileSystem()
 {
     gFileSystem.IncrementReferenceCount();
@@ -344,3 +1112,54 @@ void AttachFMODFileSystem(FMOD::System *system, int32 fileBufferSize)
 {
     gFileSystem.Attach(system, fileBufferSize);
 }
+
+FFMODFileSystemStats GetFMODFileSystemStats()
+{
+    return gFileSystem.GetStats();
+}
+
+TArray<FFMODFileStats> GetFMODFileStats()
+{
+    return gFileSystem.GetFileStats();
+}
+
+void ResetFMODFileStats()
+{
+    gFileSystem.ResetFileStats();
+}
+
+static void DumpFMODFileStats(const TArray<FString> &Args)
+{
+    if (Args.Contains(TEXT("reset")))
+    {
+        ResetFMODFileStats();
+        UE_LOG(LogFMOD, Display, TEXT("FMOD file stats reset"));
+        return;
+    }
+
+    TArray<FFMODFileStats> FileStats = GetFMODFileStats();
+    FileStats.Sort([](const FFMODFileStats &A, const FFMODFileStats &B) { return A.BytesRead > B.BytesRead; });
+
+    FString Header = TEXT("  Opens  Open      Bytes  Reads  Seeks  Queue ms |");
+    for (int32 i = 0; i < FMODFileLatencyBucketCount - 1; ++i)
+    {
+        Header += FString::Printf(TEXT(" <%5.1fms"), FMODFileLatencyBucketLimitsMs[i]);
+    }
+    Header += FString::Printf(TEXT(" >=%4.1fms | File"), FMODFileLatencyBucketLimitsMs[FMODFileLatencyBucketCount - 2]);
+    UE_LOG(LogFMOD, Display, TEXT("%s"), *Header);
+
+    for (const FFMODFileStats &Stats : FileStats)
+    {
+        FString Line = FString::Printf(TEXT("%7d %5d %10llu %6llu %6llu %9.2f |"), Stats.OpenCount, Stats.OpenHandles, Stats.BytesRead, Stats.ReadCount,
+            Stats.SeekCount, Stats.QueueWaitSeconds * 1000.0);
+        for (int32 i = 0; i < FMODFileLatencyBucketCount; ++i)
+        {
+            Line += FString::Printf(TEXT(" %8llu"), Stats.ReadLatency[i]);
+        }
+        Line += FString::Printf(TEXT(" | %s"), *Stats.Name);
+        UE_LOG(LogFMOD, Display, TEXT("%s"), *Line);
+    }
+}
+
+static FAutoConsoleCommand DumpFMODFileStatsCommand(TEXT("fmod.DumpFileStats"),
+    TEXT("Dumps per file FMOD I/O counters. Pass 'reset' to clear them."), FConsoleCommandWithArgsDelegate::CreateStatic(&DumpFMODFileStats));
@@ -4,6 +4,8 @@
 
 #include "fmod.hpp"
 #include "GenericPlatform/GenericPlatform.h"
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
 
 FMOD_RESULT F_CALLBACK FMODLogCallback(FMOD_DEBUG_FLAGS flags, const char *file, int line, const char *func, const char *message);
 FMOD_RESULT F_CALLBACK FMODErrorCallback(FMOD_SYSTEM *system, FMOD_SYSTEM_CALLBACK_TYPE type, void *commanddata1, void *commanddata2, void *userdata);
@@ -11,3 +13,37 @@ FMOD_RESULT F_CALLBACK FMODErrorCallback(FMOD_SYSTEM *system, FMOD_SYSTEM_CALLBA
 void AcquireFMODFileSystem();
 void ReleaseFMODFileSystem();
 void AttachFMODFileSystem(FMOD::System *system, FGenericPlatformTypes::int32 fileBufferSize);
+
+/** Aggregate timings for requests made through the FMOD file system. */
+struct FFMODFileSystemStats
+{
+    FGenericPlatformTypes::uint64 RequestCount = 0;
+    double TotalQueueWaitSeconds = 0.0;
+    double MaxQueueWaitSeconds = 0.0;
+    FGenericPlatformTypes::uint64 ReadAheadHits = 0;
+    FGenericPlatformTypes::uint64 ReadAheadMisses = 0;
+};
+
+FFMODFileSystemStats GetFMODFileSystemStats();
+
+/** Number of buckets in the per file read latency histogram. */
+static const FGenericPlatformTypes::int32 FMODFileLatencyBucketCount = 7;
+
+/** Upper bound of each latency bucket in milliseconds. The last bucket has no upper bound. */
+extern const double FMODFileLatencyBucketLimitsMs[FMODFileLatencyBucketCount - 1];
+
+/** I/O counters for one file path opened by FMOD. */
+struct FFMODFileStats
+{
+    FString Name;
+    FGenericPlatformTypes::int32 OpenCount = 0;
+    FGenericPlatformTypes::int32 OpenHandles = 0;
+    FGenericPlatformTypes::uint64 BytesRead = 0;
+    FGenericPlatformTypes::uint64 ReadCount = 0;
+    FGenericPlatformTypes::uint64 SeekCount = 0;
+    double QueueWaitSeconds = 0.0;
+    FGenericPlatformTypes::uint64 ReadLatency[FMODFileLatencyBucketCount] = {};
+};
+
+TArray<FFMODFileStats> GetFMODFileStats();
+void ResetFMODFileStats();
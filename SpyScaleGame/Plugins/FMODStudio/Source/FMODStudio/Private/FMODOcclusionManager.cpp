@@ -0,0 +1,297 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODOcclusionManager.h"
+#include "FMODAudioComponent.h"
+#include "FMODListener.h"
+#include "FMODSettings.h"
+#include "FMODStudioModule.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "FMODStudioPrivatePCH.h"
+#include "CoreGlobals.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD Occlusion - Rays Issued"), STAT_FMOD_Occlusion_Rays, STATGROUP_FMOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD Occlusion - Waiting Components"), STAT_FMOD_Occlusion_Waiting, STATGROUP_FMOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD Occlusion - Reused Results"), STAT_FMOD_Occlusion_Reused, STATGROUP_FMOD);
+
+// Longest a result is reused before it is traced again, so a wall being removed is eventually heard
+static const double OcclusionReuseMaxAge = 2.0;
+
+namespace
+{
+bool CanApplyOcclusion(const UFMODAudioComponent &Component)
+{
+    // The component may have stopped or changed settings since it asked for occlusion
+    return Component.StudioInstance && Component.bApplyOcclusionParameter && Component.OcclusionDetails.bEnableOcclusion;
+}
+}
+
+UFMODOcclusionManager::UFMODOcclusionManager(const FObjectInitializer &ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+}
+
+bool UFMODOcclusionManager::ShouldCreateSubsystem(UObject *Outer) const
+{
+    return Super::ShouldCreateSubsystem(Outer) && GetDefault<UFMODSettings>()->bAsyncOcclusion;
+}
+
+bool UFMODOcclusionManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFMODOcclusionManager::RequestOcclusion(UFMODAudioComponent *Component)
+{
+    if (!IsValid(Component) || !Component->GetOwner())
+    {
+        return;
+    }
+
+    FOcclusionEntry &Entry = Entries.FindOrAdd(Component);
+    Entry.Component = Component;
+
+    const float ReuseDistance = GetDefault<UFMODSettings>()->OcclusionReuseDistance;
+    if (Entry.bHasResult && Entry.bResultReusable && Entry.Handles.Num() == 0 && ReuseDistance > 0.0f &&
+        FPlatformTime::Seconds() - Entry.TracedTime < OcclusionReuseMaxAge)
+    {
+        const FVector Source = Component->GetOwner()->GetTransform().GetTranslation();
+        const FVector Listener = IFMODStudioModule::Get().GetNearestListener(Source).Transform.GetLocation();
+        const float ReuseDistanceSquared = FMath::Square(ReuseDistance);
+
+        if (FVector::DistSquared(Source, Entry.TracedSource) < ReuseDistanceSquared &&
+            FVector::DistSquared(Listener, Entry.TracedListener) < ReuseDistanceSquared)
+        {
+            // Reapplied in case the component was stopped and restarted since
+            Component->ApplyOcclusion(Entry.CurrentOcclusion);
+            INC_DWORD_STAT(STAT_FMOD_Occlusion_Reused);
+            return;
+        }
+    }
+
+    if (Entry.RequestFrame == 0)
+    {
+        Entry.RequestFrame = GFrameCounter;
+    }
+}
+
+void UFMODOcclusionManager::RemoveComponent(UFMODAudioComponent *Component)
+{
+    Entries.Remove(Component);
+}
+
+void UFMODOcclusionManager::Deinitialize()
+{
+    Entries.Empty();
+    Candidates.Empty();
+
+    Super::Deinitialize();
+}
+
+void UFMODOcclusionManager::Tick(float DeltaTime)
+{
+    UWorld *World = GetWorld();
+    if (!World || Entries.Num() == 0 || !IFMODStudioModule::IsAvailable())
+    {
+        return;
+    }
+
+    CollectResults(*World);
+    IssueTraces(*World);
+    SmoothResults(DeltaTime);
+}
+
+void UFMODOcclusionManager::CollectResults(UWorld &World)
+{
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        FOcclusionEntry &Entry = It.Value();
+        UFMODAudioComponent *Component = Entry.Component.Get();
+        if (!Component)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        if (Entry.Handles.Num() == 0)
+        {
+            continue;
+        }
+
+        bool bLost = false;
+        for (int32 i = Entry.Handles.Num() - 1; i >= 0; --i)
+        {
+            FTraceDatum Datum;
+            if (World.QueryTraceData(Entry.Handles[i], Datum))
+            {
+                for (const FHitResult &Hit : Datum.OutHits)
+                {
+                    if (Hit.bBlockingHit)
+                    {
+                        ++Entry.BlockedRays;
+
+                        const UPrimitiveComponent *HitComponent = Hit.GetComponent();
+                        Entry.bHitMovable |= !HitComponent || HitComponent->Mobility != EComponentMobility::Static;
+                    }
+                }
+                Entry.Handles.RemoveAtSwap(i);
+            }
+            else if (!World.IsTraceHandleValid(Entry.Handles[i], false))
+            {
+                bLost = true;
+            }
+        }
+
+        if (bLost)
+        {
+            // A result was discarded before it could be read, so trace again
+            Entry.Handles.Reset();
+            if (Entry.RequestFrame == 0)
+            {
+                Entry.RequestFrame = GFrameCounter;
+            }
+            continue;
+        }
+
+        if (Entry.Handles.Num() == 0)
+        {
+            Entry.bHasResult = true;
+            // Clear rays say nothing about movable objects that could step into them, so only results fully blocked by
+            // static geometry are reused
+            Entry.bResultReusable = !Entry.bHitMovable && Entry.BlockedRays == Entry.RayCount;
+            Entry.TargetOcclusion = FMath::Min((float)Entry.BlockedRays / Entry.RayCount, 1.0f);
+
+            if (Component->OcclusionDetails.OcclusionSmoothingTime <= 0.0f)
+            {
+                Entry.CurrentOcclusion = Entry.TargetOcclusion;
+                if (CanApplyOcclusion(*Component))
+                {
+                    Component->ApplyOcclusion(Entry.CurrentOcclusion);
+                }
+            }
+        }
+    }
+}
+
+void UFMODOcclusionManager::IssueTraces(UWorld &World)
+{
+    IFMODStudioModule &Module = IFMODStudioModule::Get();
+    const int32 RaysPerFrame = FMath::Max(GetDefault<UFMODSettings>()->OcclusionRaysPerFrame, 1);
+    int32 RaysWanted = 0;
+
+    for (TPair<TObjectKey<UFMODAudioComponent>, FOcclusionEntry> &Pair : Entries)
+    {
+        FOcclusionEntry &Entry = Pair.Value;
+        UFMODAudioComponent *Component = Entry.Component.Get();
+        if (Entry.RequestFrame == 0 || Entry.Handles.Num() > 0 || !Component || !Component->GetOwner())
+        {
+            continue;
+        }
+
+        // Waiting longer raises a component's score, so distant low priority components are still traced in turn
+        const FVector Location = Component->GetOwner()->GetTransform().GetTranslation();
+        const float Distance = FVector::Dist(Location, Module.GetNearestListener(Location).Transform.GetLocation());
+        const float Age = (float)(GFrameCounter - Entry.RequestFrame + 1);
+        const float Score = Age * (1 + Component->OcclusionDetails.OcclusionPriority) / FMath::Max(Distance, 100.0f);
+
+        Candidates.Emplace(Score, &Entry);
+        RaysWanted += FMath::Clamp(Component->OcclusionDetails.OcclusionRayCount, 1, RaysPerFrame);
+    }
+
+    SET_DWORD_STAT(STAT_FMOD_Occlusion_Waiting, Candidates.Num());
+
+    if (RaysWanted > RaysPerFrame)
+    {
+        Candidates.Sort([](const TPair<float, FOcclusionEntry *> &A, const TPair<float, FOcclusionEntry *> &B) { return A.Key > B.Key; });
+    }
+
+    static FName NAME_SoundOcclusion = FName(TEXT("SoundOcclusion"));
+    int32 RaysLeft = RaysPerFrame;
+
+    for (const TPair<float, FOcclusionEntry *> &Candidate : Candidates)
+    {
+        FOcclusionEntry &Entry = *Candidate.Value;
+        UFMODAudioComponent *Component = Entry.Component.Get();
+        const FFMODOcclusionDetails &Details = Component->OcclusionDetails;
+
+        // Stop rather than skip ahead, so components with many rays are not starved by cheaper ones
+        const int32 RayCount = FMath::Clamp(Details.OcclusionRayCount, 1, RaysPerFrame);
+        if (RayCount > RaysLeft)
+        {
+            break;
+        }
+        RaysLeft -= RayCount;
+
+        AActor *Owner = Component->GetOwner();
+        FCollisionQueryParams Params(NAME_SoundOcclusion, Details.bUseComplexCollisionForOcclusion, Owner);
+
+        const FVector Source = Owner->GetTransform().GetTranslation();
+        const FVector Listener = Module.GetNearestListener(Source).Transform.GetLocation();
+
+        // Extra rays start on a ring facing the listener, sized to stay within the owner's bounds
+        FVector Right, Up;
+        (Listener - Source).GetSafeNormal().FindBestAxisVectors(Right, Up);
+        const USceneComponent *Root = Owner->GetRootComponent();
+        const float Spread = Root ? Root->Bounds.BoxExtent.GetMin() : 0.0f;
+
+        for (int32 Ray = 0; Ray < RayCount; ++Ray)
+        {
+            FVector Start = Source;
+            if (Ray > 0)
+            {
+                float Sin, Cos;
+                FMath::SinCos(&Sin, &Cos, 2.0f * PI * (Ray - 1) / (RayCount - 1));
+                Start += (Right * Cos + Up * Sin) * Spread;
+            }
+
+            // Single rather than test traces, so hits on movable objects can stop the result being reused
+            Entry.Handles.Add(World.AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, Listener, Details.OcclusionTraceChannel, Params));
+        }
+
+        Entry.RayCount = RayCount;
+        Entry.BlockedRays = 0;
+        Entry.bHitMovable = false;
+        Entry.RequestFrame = 0;
+        Entry.TracedSource = Source;
+        Entry.TracedListener = Listener;
+        Entry.TracedTime = FPlatformTime::Seconds();
+
+        INC_DWORD_STAT_BY(STAT_FMOD_Occlusion_Rays, RayCount);
+    }
+
+    Candidates.Reset();
+}
+
+void UFMODOcclusionManager::SmoothResults(float DeltaTime)
+{
+    for (TPair<TObjectKey<UFMODAudioComponent>, FOcclusionEntry> &Pair : Entries)
+    {
+        FOcclusionEntry &Entry = Pair.Value;
+        if (Entry.CurrentOcclusion == Entry.TargetOcclusion)
+        {
+            continue;
+        }
+
+        UFMODAudioComponent *Component = Entry.Component.Get();
+        if (!Component)
+        {
+            continue;
+        }
+
+        const float SmoothingTime = Component->OcclusionDetails.OcclusionSmoothingTime;
+        Entry.CurrentOcclusion = SmoothingTime > 0.0f ?
+            FMath::FInterpTo(Entry.CurrentOcclusion, Entry.TargetOcclusion, DeltaTime, 1.0f / SmoothingTime) :
+            Entry.TargetOcclusion;
+
+        if (CanApplyOcclusion(*Component))
+        {
+            Component->ApplyOcclusion(Entry.CurrentOcclusion);
+        }
+    }
+}
+
+TStatId UFMODOcclusionManager::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UFMODOcclusionManager, STATGROUP_Tickables);
+}
@@ -0,0 +1,144 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODOneshotCoalescer.h"
+#include "FMODEventMetadata.h"
+#include "FMODSettings.h"
+#include "FMODUtils.h"
+#include "fmod_studio.hpp"
+#include "FMODStudioPrivatePCH.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FMOD Coalescing - Open Windows"), STAT_FMOD_Coalesce_Windows, STATGROUP_FMOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD Coalescing - Merged Plays"), STAT_FMOD_Coalesce_Merged, STATGROUP_FMOD);
+
+FFMODOneshotCoalescer::FFMODOneshotCoalescer()
+{
+}
+
+bool FFMODOneshotCoalescer::IsEnabled() const
+{
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    return Settings.OneshotCoalesceRules.Num() > 0;
+}
+
+int32 FFMODOneshotCoalescer::FindRule(const FGuid &Guid, FMOD::Studio::EventDescription *Description)
+{
+    if (const int32 *Rule = EventRules.Find(Guid))
+    {
+        return *Rule;
+    }
+
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    const FString Path = FMODUtils::GetPath(Description);
+    int32 Rule = INDEX_NONE;
+    int32 MatchLength = 0;
+
+    for (int32 i = 0; i < Settings.OneshotCoalesceRules.Num(); ++i)
+    {
+        const FString &Prefix = Settings.OneshotCoalesceRules[i].PathPrefix;
+        if (Prefix.Len() > MatchLength && Path.StartsWith(Prefix))
+        {
+            Rule = i;
+            MatchLength = Prefix.Len();
+        }
+    }
+
+    EventRules.Add(Guid, Rule);
+    return Rule;
+}
+
+void FFMODOneshotCoalescer::Prune(double Now)
+{
+    for (int32 i = Windows.Num() - 1; i >= 0; --i)
+    {
+        if (Now > Windows[i].EndTime || !Windows[i].Instance->isValid())
+        {
+            Windows.RemoveAtSwap(i);
+            DEC_DWORD_STAT(STAT_FMOD_Coalesce_Windows);
+        }
+    }
+}
+
+FMOD::Studio::EventInstance *FFMODOneshotCoalescer::Merge(
+    const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FVector &Location)
+{
+    if (Windows.Num() == 0 || !Description || FindRule(Guid, Description) == INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    Prune(FPlatformTime::Seconds());
+
+    for (FWindow &Window : Windows)
+    {
+        if (Window.Guid == Guid && FVector::DistSquared(Window.Location, Location) <= Window.RadiusSquared)
+        {
+            ++Window.PlayCount;
+            if (Window.bHasIntensity)
+            {
+                verifyfmod(Window.Instance->setParameterByID(Window.IntensityId, (float)Window.PlayCount));
+            }
+
+            INC_DWORD_STAT(STAT_FMOD_Coalesce_Merged);
+            return Window.Instance;
+        }
+    }
+
+    return nullptr;
+}
+
+void FFMODOneshotCoalescer::Open(const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FFMODEventMetadata &Metadata,
+    const FVector &Location, FMOD::Studio::EventInstance *Instance)
+{
+    // Looping events are never fire-and-forget, a merged play would outlive its window
+    if (!Instance || !Description || !Metadata.bIsOneshot)
+    {
+        return;
+    }
+
+    const int32 Rule = FindRule(Guid, Description);
+    if (Rule == INDEX_NONE)
+    {
+        return;
+    }
+
+    const FFMODOneshotCoalesceRule &Settings = GetDefault<UFMODSettings>()->OneshotCoalesceRules[Rule];
+
+    // Pooled instances are reused, so an earlier window may still hold this one
+    FWindow *Window = Windows.FindByPredicate([Instance](const FWindow &Existing) { return Existing.Instance == Instance; });
+    if (!Window)
+    {
+        Window = &Windows.AddDefaulted_GetRef();
+        INC_DWORD_STAT(STAT_FMOD_Coalesce_Windows);
+    }
+
+    Window->Instance = Instance;
+    Window->Guid = Guid;
+    Window->Location = Location;
+    Window->EndTime = FPlatformTime::Seconds() + Settings.Window / 1000.0;
+    Window->RadiusSquared = FMath::Square(Settings.Radius);
+    Window->PlayCount = 1;
+    Window->bHasIntensity = false;
+
+    if (!Settings.IntensityParameter.IsEmpty())
+    {
+        const FFMODEventParameterInfo *Parameter = Metadata.FindParameter(FName(*Settings.IntensityParameter));
+        if (Parameter)
+        {
+            Window->IntensityId = Parameter->Id;
+            Window->bHasIntensity = true;
+            verifyfmod(Instance->setParameterByID(Parameter->Id, 1.0f));
+        }
+        else
+        {
+            UE_LOG(LogFMOD, Verbose, TEXT("Coalescing intensity parameter %s not found on event %s"), *Settings.IntensityParameter,
+                *FMODUtils::GetPath(Description));
+        }
+    }
+}
+
+void FFMODOneshotCoalescer::Reset()
+{
+    DEC_DWORD_STAT_BY(STAT_FMOD_Coalesce_Windows, Windows.Num());
+    Windows.Reset();
+    EventRules.Reset();
+}
@@ -0,0 +1,60 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "fmod_studio_common.h"
+
+namespace FMOD
+{
+namespace Studio
+{
+class EventDescription;
+class EventInstance;
+}
+}
+
+struct FFMODEventMetadata;
+
+/**
+ * Merges fire-and-forget plays of an event that land within a short window and radius of an earlier play into that
+ * play's instance, as configured by OneshotCoalesceRules. The merged instance's intensity parameter, if the rule names
+ * one, is set to the number of plays it stands for. Game thread only.
+ */
+class FFMODOneshotCoalescer
+{
+public:
+    FFMODOneshotCoalescer();
+
+    /** Whether any coalescing rules are configured. When there are none, every play gets its own instance. */
+    bool IsEnabled() const;
+
+    /** Merge a play into an open window of the same event near Location. Returns the instance merged into, or null. */
+    FMOD::Studio::EventInstance *Merge(const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FVector &Location);
+
+    /** Open a window on an instance about to be started for a play that wasn't merged, if a rule covers the event. */
+    void Open(const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FFMODEventMetadata &Metadata,
+        const FVector &Location, FMOD::Studio::EventInstance *Instance);
+
+    /** Close all windows, used when runtime banks are unloaded. */
+    void Reset();
+
+private:
+    struct FWindow
+    {
+        FMOD::Studio::EventInstance *Instance = nullptr;
+        FGuid Guid;
+        FVector Location = FVector::ZeroVector;
+        double EndTime = 0.0;
+        float RadiusSquared = 0.0f;
+        int32 PlayCount = 1;
+        FMOD_STUDIO_PARAMETER_ID IntensityId = {};
+        bool bHasIntensity = false;
+    };
+
+    int32 FindRule(const FGuid &Guid, FMOD::Studio::EventDescription *Description);
+    void Prune(double Now);
+
+    TArray<FWindow> Windows;
+    TMap<FGuid, int32> EventRules;
+};
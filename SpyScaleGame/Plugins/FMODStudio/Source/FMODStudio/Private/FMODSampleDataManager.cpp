@@ -0,0 +1,174 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODSampleDataManager.h"
+#include "FMODEventInstancePool.h"
+#include "FMODSettings.h"
+#include "FMODUtils.h"
+#include "fmod_studio.hpp"
+#include "FMODStudioPrivatePCH.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FMOD Sample Data - Resident Events"), STAT_FMOD_SampleData_Resident, STATGROUP_FMOD);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FMOD Sample Data - Evictions"), STAT_FMOD_SampleData_Evictions, STATGROUP_FMOD);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FMOD Sample Data - Reloads"), STAT_FMOD_SampleData_Reloads, STATGROUP_FMOD);
+DECLARE_MEMORY_STAT(TEXT("FMOD Sample Data - Memory"), STAT_FMOD_SampleData_Memory, STATGROUP_FMOD);
+
+// How often memory is compared against the budget. FMOD frees sample data asynchronously, so at most one event
+// is evicted per update to give the measurement time to catch up.
+static const double SampleDataUpdateInterval = 0.25;
+
+// Events used more recently than this are never evicted, so a burst of new sounds cannot evict each other
+static const double SampleDataMinResidentTime = 2.0;
+
+FFMODSampleDataManager::FFMODSampleDataManager()
+    : NextUpdateTime(0.0)
+    , EvictionCount(0)
+    , ReloadCount(0)
+    , bMemoryTracking(false)
+{
+}
+
+bool FFMODSampleDataManager::IsEnabled() const
+{
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    return Settings.SampleDataBudget > 0 && bMemoryTracking;
+}
+
+FFMODSampleDataManager::FEntry &FFMODSampleDataManager::Use(const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FString &Name)
+{
+    FEntry &Entry = Entries.FindOrAdd(Guid);
+    Entry.Name = Name;
+    Entry.Description = Description;
+    Entry.LastUsedTime = FPlatformTime::Seconds();
+
+    if (!Entry.bResident)
+    {
+        if (Entry.bEvicted)
+        {
+            ++ReloadCount;
+            INC_DWORD_STAT(STAT_FMOD_SampleData_Reloads);
+            UE_LOG(LogFMOD, Verbose, TEXT("Reloading sample data for %s (%llu reloads)"), *Name, ReloadCount);
+        }
+
+        verifyfmod(Description->loadSampleData());
+        Entry.bResident = true;
+        Entry.bEvicted = false;
+        INC_DWORD_STAT(STAT_FMOD_SampleData_Resident);
+    }
+
+    return Entry;
+}
+
+void FFMODSampleDataManager::Touch(const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FString &Name)
+{
+    if (Description && IsEnabled())
+    {
+        Use(Guid, Description, Name);
+    }
+}
+
+int64 FFMODSampleDataManager::MeasureSampleData(FMOD::Studio::EventDescription *Description)
+{
+    // Instances report the sample data their event uses, which is only filled in with memory tracking
+    FMOD::Studio::EventInstance *Instance = nullptr;
+    int Count = 0;
+    if (Description->getInstanceList(&Instance, 1, &Count) != FMOD_OK || Count == 0)
+    {
+        return 0;
+    }
+
+    FMOD_STUDIO_MEMORY_USAGE Usage = {};
+    if (Instance->getMemoryUsage(&Usage) == FMOD_OK)
+    {
+        return Usage.sampledata;
+    }
+    return 0;
+}
+
+void FFMODSampleDataManager::Update(FMOD::Studio::System *System, FFMODEventInstancePool &InstancePool)
+{
+    if (!System || !IsEnabled())
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    if (Now < NextUpdateTime)
+    {
+        return;
+    }
+    NextUpdateTime = Now + SampleDataUpdateInterval;
+
+    // Only what this manager loaded counts, anything else resident is outside its control
+    int64 Memory = 0;
+    FEntry *Oldest = nullptr;
+    const FGuid *OldestGuid = nullptr;
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        FEntry &Entry = It.Value();
+        if (!Entry.Description->isValid())
+        {
+            // Its bank was unloaded, taking the sample data with it
+            if (Entry.bResident)
+            {
+                DEC_DWORD_STAT(STAT_FMOD_SampleData_Resident);
+            }
+            It.RemoveCurrent();
+            continue;
+        }
+
+        if (!Entry.bResident)
+        {
+            continue;
+        }
+
+        int InstanceCount = 0;
+        Entry.Description->getInstanceCount(&InstanceCount);
+        if (InstanceCount > 0)
+        {
+            Entry.SampleDataSize = FMath::Max(Entry.SampleDataSize, MeasureSampleData(Entry.Description));
+        }
+        Memory += Entry.SampleDataSize;
+
+        // Stopped pooled instances are only waiting to be reused, so they don't keep the event resident
+        if (Now - Entry.LastUsedTime < SampleDataMinResidentTime || InstanceCount > InstancePool.GetStoppedCount(It.Key()))
+        {
+            continue;
+        }
+
+        if (!Oldest || Entry.LastUsedTime < Oldest->LastUsedTime)
+        {
+            Oldest = &Entry;
+            OldestGuid = &It.Key();
+        }
+    }
+
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    SET_MEMORY_STAT(STAT_FMOD_SampleData_Memory, Memory);
+
+    if (Memory <= Settings.SampleDataBudget || !Oldest)
+    {
+        return;
+    }
+
+    InstancePool.Release(*OldestGuid);
+    Oldest->Description->unloadSampleData();
+    Oldest->bResident = false;
+    Oldest->bEvicted = true;
+    ++EvictionCount;
+    DEC_DWORD_STAT(STAT_FMOD_SampleData_Resident);
+    INC_DWORD_STAT(STAT_FMOD_SampleData_Evictions);
+    UE_LOG(LogFMOD, Log, TEXT("Evicted sample data for %s, %lld bytes over budget (%llu evictions, %llu reloads)"), *Oldest->Name,
+        Memory - Settings.SampleDataBudget, EvictionCount, ReloadCount);
+}
+
+void FFMODSampleDataManager::Reset()
+{
+    for (TPair<FGuid, FEntry> &Pair : Entries)
+    {
+        if (Pair.Value.bResident)
+        {
+            DEC_DWORD_STAT(STAT_FMOD_SampleData_Resident);
+        }
+    }
+    Entries.Reset();
+}
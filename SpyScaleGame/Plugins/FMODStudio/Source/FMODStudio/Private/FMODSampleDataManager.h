@@ -0,0 +1,71 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace FMOD
+{
+namespace Studio
+{
+class System;
+class EventDescription;
+}
+}
+
+class FFMODEventInstancePool;
+
+/**
+ * Keeps event sample data resident within the SampleDataBudget setting.
+ * Events are loaded when played, and the least recently used idle events are evicted while over budget.
+ * An event whose only instances are stopped ones in the instance pool counts as idle, and its pool is released on eviction.
+ * Only the sample data of the events it loaded counts against the budget, so banks loaded with bLoadAllSampleData
+ * and preloaded components can't make it evict. Each event's size is read from Studio's memory tracking while it has
+ * an instance, so the manager is disabled without it.
+ * Game thread only.
+ */
+class FFMODSampleDataManager
+{
+public:
+    FFMODSampleDataManager();
+
+    /** Whether a budget is configured and can be measured. When it is not, the manager does nothing. */
+    bool IsEnabled() const;
+
+    /** Whether the runtime system was created with memory tracking. Set by the module when it creates the system. */
+    void SetMemoryTracking(bool bEnabled) { bMemoryTracking = bEnabled; }
+
+    /** Mark an event as used now, loading its sample data if it is not resident. */
+    void Touch(const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FString &Name);
+
+    /** Check memory against the budget and evict if needed. Called from the module tick. */
+    void Update(FMOD::Studio::System *System, FFMODEventInstancePool &InstancePool);
+
+    /** Forget all tracked events, used when the runtime system is destroyed. */
+    void Reset();
+
+    uint64 GetEvictionCount() const { return EvictionCount; }
+    uint64 GetReloadCount() const { return ReloadCount; }
+
+private:
+    struct FEntry
+    {
+        FString Name;
+        FMOD::Studio::EventDescription *Description = nullptr;
+        double LastUsedTime = 0.0;
+
+        /** Largest sample data use seen on one of the event's instances, or 0 until one has been measured */
+        int64 SampleDataSize = 0;
+        bool bResident = false;
+        bool bEvicted = false;
+    };
+
+    FEntry &Use(const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FString &Name);
+    static int64 MeasureSampleData(FMOD::Studio::EventDescription *Description);
+
+    TMap<FGuid, FEntry> Entries;
+    double NextUpdateTime;
+    uint64 EvictionCount;
+    uint64 ReloadCount;
+    bool bMemoryTracking;
+};
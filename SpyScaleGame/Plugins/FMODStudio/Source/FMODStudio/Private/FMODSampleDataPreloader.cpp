@@ -0,0 +1,158 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODSampleDataPreloader.h"
+#include "FMODAudioComponent.h"
+#include "FMODEvent.h"
+#include "FMODEventMetadata.h"
+#include "FMODListener.h"
+#include "FMODSettings.h"
+#include "FMODStudioModule.h"
+#include "FMODUtils.h"
+#include "Engine/World.h"
+#include "fmod_studio.hpp"
+#include "FMODStudioPrivatePCH.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FMOD Preloaded Components"), STAT_FMOD_Preloaded_Components, STATGROUP_FMOD);
+
+UFMODSampleDataPreloader::UFMODSampleDataPreloader(const FObjectInitializer &ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+}
+
+bool UFMODSampleDataPreloader::ShouldCreateSubsystem(UObject *Outer) const
+{
+    return Super::ShouldCreateSubsystem(Outer) && GetDefault<UFMODSettings>()->bPreloadNearbySampleData;
+}
+
+bool UFMODSampleDataPreloader::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFMODSampleDataPreloader::RegisterComponent(UFMODAudioComponent *Component)
+{
+    if (IsValid(Component))
+    {
+        FPreloadEntry &Entry = Entries.FindOrAdd(Component);
+        Entry.Component = Component;
+    }
+}
+
+void UFMODSampleDataPreloader::UnregisterComponent(UFMODAudioComponent *Component)
+{
+    FPreloadEntry Entry;
+    if (Entries.RemoveAndCopyValue(Component, Entry))
+    {
+        Unload(Entry);
+    }
+}
+
+void UFMODSampleDataPreloader::Deinitialize()
+{
+    for (TPair<TObjectKey<UFMODAudioComponent>, FPreloadEntry> &Pair : Entries)
+    {
+        Unload(Pair.Value);
+    }
+    Entries.Empty();
+
+    Super::Deinitialize();
+}
+
+void UFMODSampleDataPreloader::RefreshEvent(FPreloadEntry &Entry, UFMODEvent *Event)
+{
+    Unload(Entry);
+
+    Entry.Event = Event;
+    Entry.Description = nullptr;
+    Entry.MaxDistance = -1.0f;
+
+    if (IsValid(Event))
+    {
+        Entry.Description = IFMODStudioModule::Get().GetEventDescription(Event, EFMODSystemContext::Runtime);
+    }
+
+    TSharedPtr<const FFMODEventMetadata> Metadata =
+        Entry.Description ? IFMODStudioModule::Get().GetEventMetadata(Event, EFMODSystemContext::Runtime) : nullptr;
+    if (Metadata.IsValid() && Metadata->bIs3D)
+    {
+        Entry.MaxDistance = FMODUtils::DistanceToUEScale(Metadata->MaxDistance);
+    }
+}
+
+void UFMODSampleDataPreloader::Unload(FPreloadEntry &Entry)
+{
+    if (Entry.bLoaded)
+    {
+        if (Entry.Description && Entry.Description->isValid())
+        {
+            verifyfmod(Entry.Description->unloadSampleData());
+        }
+        Entry.bLoaded = false;
+        DEC_DWORD_STAT(STAT_FMOD_Preloaded_Components);
+    }
+}
+
+void UFMODSampleDataPreloader::Tick(float DeltaTime)
+{
+    if (!IFMODStudioModule::IsAvailable())
+    {
+        return;
+    }
+
+    IFMODStudioModule &Module = IFMODStudioModule::Get();
+    if (!Module.GetStudioSystem(EFMODSystemContext::Runtime))
+    {
+        return;
+    }
+
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        FPreloadEntry &Entry = It.Value();
+        UFMODAudioComponent *Component = Entry.Component.Get();
+        if (!Component)
+        {
+            Unload(Entry);
+            It.RemoveCurrent();
+            continue;
+        }
+
+        // Events can be swapped at runtime, and descriptions become invalid when their bank is unloaded
+        if (Entry.Event.Get() != Component->Event || (Entry.Description && !Entry.Description->isValid()))
+        {
+            RefreshEvent(Entry, Component->Event);
+        }
+
+        if (!Entry.Description || Entry.MaxDistance < 0.0f)
+        {
+            continue;
+        }
+
+        float MaxDistance = Entry.MaxDistance;
+        if (Component->AttenuationDetails.bOverrideAttenuation)
+        {
+            MaxDistance = FMODUtils::DistanceToUEScale(Component->AttenuationDetails.MaximumDistance);
+        }
+
+        const FVector Location = Component->GetComponentLocation();
+        const FFMODListener &Listener = Module.GetNearestListener(Location);
+        const float Distance = FVector::Dist(Location, Listener.Transform.GetTranslation());
+
+        if (!Entry.bLoaded && Distance <= MaxDistance + Settings.SampleDataPreloadMargin)
+        {
+            verifyfmod(Entry.Description->loadSampleData());
+            Entry.bLoaded = true;
+            INC_DWORD_STAT(STAT_FMOD_Preloaded_Components);
+        }
+        else if (Entry.bLoaded && Distance > MaxDistance + Settings.SampleDataPreloadMargin + Settings.SampleDataPreloadHysteresis)
+        {
+            Unload(Entry);
+        }
+    }
+}
+
+TStatId UFMODSampleDataPreloader::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UFMODSampleDataPreloader, STATGROUP_Tickables);
+}
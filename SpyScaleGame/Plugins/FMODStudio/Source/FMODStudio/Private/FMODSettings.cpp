@@ -39,10 +39,28 @@ UFMODSettings::UFMODSettings(const FObjectInitializer &ObjectInitializer)
     : Super(ObjectInitializer)
     , bLoadAllBanks(true)
     , bLoadAllSampleData(false)
+    , bLoadBanksAsync(false)
+    , BankUnloadGracePeriod(5.0f)
+    , bMemoryMapBanks(false)
+    , SampleDataBudget(0)
+    , bPreloadNearbySampleData(false)
+    , SampleDataPreloadMargin(1000.0f)
+    , SampleDataPreloadHysteresis(500.0f)
+    , OneshotPoolSize(0)
+    , OneshotPoolPrewarmCount(2)
+    , OneshotPoolIdleTime(30.0f)
+    , bBatchAudioComponentTicks(false)
     , bEnableLiveUpdate(true)
     , bEnableEditorLiveUpdate(false)
     , OutputFormat(EFMODSpeakerMode::Surround_5_1)
     , OutputType(EFMODOutput::TYPE_AUTODETECT)
+    , LocaleSwitchTimeout(10.0f)
+    , bEnableVoiceBudget(false)
+    , MaxInstancesPerEvent(8)
+    , VoiceCullDistanceMargin(500.0f)
+    , bAsyncOcclusion(false)
+    , OcclusionRaysPerFrame(16)
+    , OcclusionReuseDistance(25.0f)
     , bVol0Virtual(true)
     , Vol0VirtualLevel(0.001f)
     , SampleRate(0)
@@ -52,6 +70,9 @@ UFMODSettings::UFMODSettings(const FObjectInitializer &ObjectInitializer)
     , DSPBufferLength(0)
     , DSPBufferCount(0)
     , FileBufferSize(2048)
+    , FileAccess(EFMODFileAccess::Synchronous)
+    , FileReadAheadSize(0)
+    , FileThreadCount(2)
     , StudioUpdatePeriod(0)
     , bLockAllBuses(false)
     , LiveUpdatePort(9264)
@@ -61,6 +82,7 @@ UFMODSettings::UFMODSettings(const FObjectInitializer &ObjectInitializer)
     , bEnableMemoryTracking(false)
     , ContentBrowserPrefix(TEXT("/Game/FMOD/"))
     , MasterBankName(TEXT("Master"))
+    , bUseBankContainer(false)
     , LoggingLevel(LEVEL_WARNING)
 {
     BankOutputDirectory.Path = TEXT("FMOD");
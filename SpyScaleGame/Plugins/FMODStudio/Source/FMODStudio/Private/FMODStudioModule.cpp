@@ -5,10 +5,20 @@
 #include "FMODAudioComponent.h"
 #include "FMODBlueprintStatics.h"
 #include "FMODAssetTable.h"
+#include "FMODAttributeBatch.h"
+#include "FMODBankLoader.h"
+#include "FMODBankTelemetry.h"
 #include "FMODFileCallbacks.h"
 #include "FMODUtils.h"
 #include "FMODEvent.h"
+#include "FMODBank.h"
+#include "FMODEventMetadata.h"
 #include "FMODListener.h"
+#include "FMODSampleDataManager.h"
+#include "FMODBankReferences.h"
+#include "FMODEventInstancePool.h"
+#include "FMODOneshotCoalescer.h"
+#include "FMODVoiceBudget.h"
 #include "FMODSnapshotReverb.h"
 
 #include "Async/Async.h"
@@ -45,7 +55,6 @@
 
 DEFINE_LOG_CATEGORY(LogFMOD);
 
-DECLARE_STATS_GROUP(TEXT("FMOD"), STATGROUP_FMOD, STATCAT_Advanced);
 DECLARE_FLOAT_COUNTER_STAT(TEXT("FMOD CPU - Mixer"), STAT_FMOD_CPUMixer, STATGROUP_FMOD);
 DECLARE_FLOAT_COUNTER_STAT(TEXT("FMOD CPU - Studio"), STAT_FMOD_CPUStudio, STATGROUP_FMOD);
 DECLARE_MEMORY_STAT(TEXT("FMOD Memory - Current"), STAT_FMOD_Current_Memory, STATGROUP_FMOD);
@@ -114,6 +123,60 @@ struct FFMODSnapshotEntry
     float FadeIntensityEnd;
 };
 
+struct NamedBankEntry
+{
+    NamedBankEntry()
+        : Bank(nullptr)
+    {
+    }
+    NamedBankEntry(const FString &InName, FMOD::Studio::Bank *InBank, FMOD_RESULT InResult)
+        : Name(InName)
+        , Bank(InBank)
+        , Result(InResult)
+    {
+    }
+
+    FString Name;
+    FMOD::Studio::Bank *Bank;
+    FMOD_RESULT Result;
+    FFMODBankLoadTimings Timings;
+};
+
+static FMOD_RESULT LoadNamedBank(FMOD::Studio::System *System, const FString &Path, FMOD_STUDIO_LOAD_BANK_FLAGS Flags,
+    TArray<NamedBankEntry> &BankEntries, FMOD::Studio::Bank **OutBank = nullptr)
+{
+    FFMODBankLoadTimings Timings;
+    FMOD::Studio::Bank *Bank = nullptr;
+
+    Timings.BeginQueue();
+    FMOD_RESULT Result = LoadFMODBank(System, Path, Flags, &Bank);
+    Timings.EndQueue();
+
+    NamedBankEntry &Entry = BankEntries.Add_GetRef(NamedBankEntry(Path, Bank, Result));
+    Entry.Timings = Timings;
+
+    if (OutBank)
+    {
+        *OutBank = Bank;
+    }
+    return Result;
+}
+
+/** A loaded localized bank being replaced by SwitchLocale */
+struct FLocaleBankSwap
+{
+    FGuid Guid;
+    FString NewPath;
+
+    // The bank being replaced, until its events have stopped and it is unloaded
+    FMOD::Studio::Bank *OldBank = nullptr;
+
+    // The replacement, once it has been queued for loading
+    FMOD::Studio::Bank *NewBank = nullptr;
+
+    bool bLoadSampleData = false;
+};
+
 class FFMODStudioSystemClockSink : public IMediaClockSink
 {
 public:
@@ -135,6 +198,9 @@ public:
                 UpdateListenerPosition.Execute();
             }
 
+            // One set3DAttributes per moved component, whichever system's sink ticks first
+            FlushFMOD3DAttributes();
+
             LastResult = System->update();
         }
     }
@@ -159,6 +225,7 @@ public:
     /** IModuleInterface implementation */
     FFMODStudioModule()
         : AuditioningInstance(nullptr)
+        , LocaleSwitchStartTime(0.0)
         , ListenerCount(1)
         , bSimulating(false)
         , bIsInPIE(false)
@@ -174,6 +241,7 @@ public:
         for (int i = 0; i < EFMODSystemContext::Max; ++i)
         {
             StudioSystem[i] = nullptr;
+            bBankLoadPending[i] = false;
         }
     }
 
@@ -200,10 +268,14 @@ public:
     bool LoadLibraries();
 
     void LoadBanks(EFMODSystemContext::Type Type);
+    void FinishLoadBanks(EFMODSystemContext::Type Type, TArray<NamedBankEntry> &BankEntries);
+    void PollPendingBankLoads(EFMODSystemContext::Type Type);
     void UnloadBanks(EFMODSystemContext::Type Type);
+    void CacheEventMetadata(FMOD::Studio::Bank *Bank);
 
 #if WITH_EDITOR
     void ReloadBanks();
+    bool ReloadChangedBanks(const TArray<FString> &ChangedFiles);
 #endif
 
     void CreateStudioSystem(EFMODSystemContext::Type Type);
@@ -216,6 +288,7 @@ public:
 
     virtual FMOD::Studio::System *GetStudioSystem(EFMODSystemContext::Type Context) override;
     virtual FMOD::Studio::EventDescription *GetEventDescription(const UFMODEvent *Event, EFMODSystemContext::Type Type) override;
+    virtual TSharedPtr<const FFMODEventMetadata> GetEventMetadata(const UFMODEvent *Event, EFMODSystemContext::Type Type) override;
     virtual FMOD::Studio::EventInstance *CreateAuditioningInstance(const UFMODEvent *Event) override;
     virtual void StopAuditioningInstance() override;
 
@@ -232,7 +305,12 @@ public:
 
     virtual UFMODAsset *FindAssetByName(const FString &Name) override;
     virtual UFMODEvent *FindEventByName(const FString &Name) override;
+    virtual void FindAssetByNameAsync(const FString &Name, FOnFMODAssetFound OnFound) override;
     virtual FString GetBankPath(const UFMODBank &Bank) override;
+    virtual bool AcquireManagedBank(const UFMODBank &Bank) override;
+    virtual void ReleaseManagedBank(const FGuid &BankGuid) override;
+    virtual int32 GetManagedBankRefCount(const FGuid &BankGuid) override;
+    virtual bool IsManagedBankLoaded(const FGuid &BankGuid) override;
     virtual void GetAllBankPaths(TArray<FString> &Paths, bool IncludeMasterBank) const override;
 
     virtual TArray<FString> GetFailedBankLoads(EFMODSystemContext::Type Context) override { return FailedBankLoads[Context]; }
@@ -255,8 +333,23 @@ public:
 
     virtual bool AreBanksLoaded() override;
 
+    virtual FOnBanksLoaded &OnBanksLoaded() override { return BanksLoadedEvent; }
+
+    virtual void NotifyEventPlayed(const UFMODEvent *Event) override;
+    virtual FMOD::Studio::EventInstance *AcquirePooledInstance(const UFMODEvent *Event) override;
+    virtual bool RequestVoice(const UFMODEvent *Event, const FVector &Location, float MaxDistanceOverride) override;
+    virtual void TrackVoice(const UFMODEvent *Event, FMOD::Studio::EventInstance *Instance) override;
+    virtual FMOD::Studio::EventInstance *CoalesceOneshot(const UFMODEvent *Event, const FVector &Location) override;
+    virtual void OpenCoalesceWindow(const UFMODEvent *Event, const FVector &Location, FMOD::Studio::EventInstance *Instance) override;
+
     virtual bool SetLocale(const FString& Locale) override;
 
+    virtual bool SwitchLocale(const FString& Locale) override;
+
+    virtual bool IsSwitchingLocale() override { return LocaleBankSwaps.Num() > 0; }
+
+    void UpdateLocaleSwitch();
+
     virtual FString GetLocale() override;
 
     virtual FString GetDefaultLocale() override;
@@ -287,6 +380,50 @@ public:
     /** List of failed bank files */
     TArray<FString> FailedBankLoads[EFMODSystemContext::Max];
 
+    /** Banks still loading in the background, polled each tick when loading asynchronously */
+    TArray<NamedBankEntry> PendingBankLoads[EFMODSystemContext::Max];
+    bool bBankLoadPending[EFMODSystemContext::Max];
+
+#if WITH_EDITOR
+    /**
+     * Auditioning banks by full file path, so changed files can be reloaded individually.
+     * Banks that failed to load are kept with a null bank so a later change retries them.
+     */
+    TMap<FString, FMOD::Studio::Bank *> AuditioningBankFiles;
+#endif
+
+    /** Broadcast when all banks queued by LoadBanks have finished loading */
+    FOnBanksLoaded BanksLoadedEvent;
+
+    /** Localized runtime banks still being swapped by SwitchLocale */
+    TArray<FLocaleBankSwap> LocaleBankSwaps;
+    double LocaleSwitchStartTime;
+
+    /** Budgeted event sample data for the runtime system */
+    FFMODSampleDataManager SampleDataManager;
+
+    /** Runtime bank references taken by UFMODBankManager, kept across world teardown */
+    FFMODBankReferences BankReferences;
+
+    /** Reusable oneshot instances for the runtime system */
+    FFMODEventInstancePool InstancePool;
+
+    /** Oneshot instance limits for the runtime system */
+    FFMODVoiceBudget VoiceBudget;
+
+    /** Merges near simultaneous runtime oneshot plays */
+    FFMODOneshotCoalescer OneshotCoalescer;
+
+    /** Immutable event metadata, and the bank generation it was built in */
+    struct FCachedEventMetadata
+    {
+        TSharedPtr<const FFMODEventMetadata> Metadata;
+        uint32 Generation = 0;
+    };
+
+    /** Event metadata by event ID, shared by every system context */
+    TMap<FGuid, FCachedEventMetadata> EventMetadata;
+
     /** List of required plugins we found when loading banks. */
     TArray<FString> RequiredPlugins;
 
@@ -606,6 +743,17 @@ void FFMODStudioModule::CreateStudioSystem(EFMODSystemContext::Type Type)
     }
 
 #endif
+    if (Type == EFMODSystemContext::Runtime)
+    {
+        // The sample data budget is measured with Studio's memory tracking, without it there is nothing to measure
+        const bool bMemoryTracking = (StudioInitFlags & FMOD_STUDIO_INIT_MEMORY_TRACKING) != 0;
+        if (Settings.SampleDataBudget > 0 && !bMemoryTracking)
+        {
+            UE_LOG(LogFMOD, Warning, TEXT("SampleDataBudget is disabled, it requires bEnableMemoryTracking in a logging build"));
+        }
+        SampleDataManager.SetMemoryTracking(bMemoryTracking);
+    }
+
     if (Type == EFMODSystemContext::Auditioning || Type == EFMODSystemContext::Editor)
     {
         StudioInitFlags |= FMOD_STUDIO_INIT_ALLOW_MISSING_PLUGINS;
@@ -730,6 +878,7 @@ void FFMODStudioModule::CreateStudioSystem(EFMODSystemContext::Type Type)
     verifyfmod(StudioSystem[Type]->setAdvancedSettings(&advStudioSettings));
 
     verifyfmod(StudioSystem[Type]->initialize(Settings.TotalChannelCount, StudioInitFlags, InitFlags, InitData));
+    AttachFMODBankLoader(StudioSystem[Type]);
 
     for (FString PluginName : Settings.PluginFiles)
     {
@@ -784,15 +933,43 @@ void FFMODStudioModule::DestroyStudioSystem(EFMODSystemContext::Type Type)
 
     UnloadBanks(Type);
 
+    if (Type == EFMODSystemContext::Runtime)
+    {
+        SampleDataManager.Reset();
+    }
+
     if (StudioSystem[Type])
     {
+        ResetFMODBankLoadTracking(StudioSystem[Type]);
         verifyfmod(StudioSystem[Type]->release());
         StudioSystem[Type] = nullptr;
     }
+
+    BumpFMODBankGeneration();
 }
 
 void FFMODStudioModule::UnloadBanks(EFMODSystemContext::Type Type)
 {
+    BumpFMODBankGeneration();
+    PendingBankLoads[Type].Reset();
+    bBankLoadPending[Type] = false;
+
+    if (Type == EFMODSystemContext::Runtime)
+    {
+        LocaleBankSwaps.Reset();
+        BankReferences.Reset();
+        InstancePool.Reset();
+        VoiceBudget.Reset();
+        OneshotCoalescer.Reset();
+    }
+
+#if WITH_EDITOR
+    if (Type == EFMODSystemContext::Auditioning)
+    {
+        AuditioningBankFiles.Reset();
+    }
+#endif
+
     if (StudioSystem[Type])
     {
         int bankCount;
@@ -814,6 +991,21 @@ void FFMODStudioModule::UnloadBanks(EFMODSystemContext::Type Type)
 
 bool FFMODStudioModule::Tick(float DeltaTime)
 {
+    UpdateFMODBankLoadTracking();
+
+    if (LocaleBankSwaps.Num() > 0)
+    {
+        UpdateLocaleSwitch();
+    }
+
+    for (int i = 0; i < EFMODSystemContext::Max; ++i)
+    {
+        if (bBankLoadPending[i])
+        {
+            PollPendingBankLoads((EFMODSystemContext::Type)i);
+        }
+    }
+
     if (ClockSinks[EFMODSystemContext::Auditioning].IsValid())
     {
         verifyfmod(ClockSinks[EFMODSystemContext::Auditioning]->LastResult);
@@ -839,6 +1031,14 @@ bool FFMODStudioModule::Tick(float DeltaTime)
         SET_DWORD_STAT(STAT_FMOD_Total_Channels, channels);
 
         verifyfmod(ClockSinks[EFMODSystemContext::Runtime]->LastResult);
+
+        SampleDataManager.Update(StudioSystem[EFMODSystemContext::Runtime], InstancePool);
+        InstancePool.Update();
+        if (VoiceBudget.IsEnabled())
+        {
+            VoiceBudget.Update();
+        }
+        BankReferences.Update(StudioSystem[EFMODSystemContext::Runtime]);
     }
     if (ClockSinks[EFMODSystemContext::Editor].IsValid())
     {
@@ -1161,17 +1361,34 @@ UFMODEvent *FFMODStudioModule::FindEventByName(const FString &Name)
     return Cast<UFMODEvent>(Asset);
 }
 
+void FFMODStudioModule::FindAssetByNameAsync(const FString &Name, FOnFMODAssetFound OnFound)
+{
+    AssetTable.GetAssetByStudioPathAsync(Name, [OnFound](UFMODAsset *Asset) { OnFound.ExecuteIfBound(Asset); });
+}
+
 FString FFMODStudioModule::GetBankPath(const UFMODBank &Bank)
 {
-    FString BankPath = AssetTable.GetBankPath(Bank);
+    return AssetTable.GetBankPath(Bank);
+}
 
-    if (!BankPath.IsEmpty())
-    {
-        const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
-        BankPath = Settings.GetFullBankPath() / BankPath;
-    }
+bool FFMODStudioModule::AcquireManagedBank(const UFMODBank &Bank)
+{
+    return BankReferences.Acquire(StudioSystem[EFMODSystemContext::Runtime], Bank.AssetGuid, GetBankPath(Bank), Bank.GetName());
+}
+
+void FFMODStudioModule::ReleaseManagedBank(const FGuid &BankGuid)
+{
+    BankReferences.Release(BankGuid);
+}
+
+int32 FFMODStudioModule::GetManagedBankRefCount(const FGuid &BankGuid)
+{
+    return BankReferences.GetRefCount(BankGuid);
+}
 
-    return BankPath;
+bool FFMODStudioModule::IsManagedBankLoaded(const FGuid &BankGuid)
+{
+    return BankReferences.IsLoaded(BankGuid);
 }
 
 void FFMODStudioModule::GetAllBankPaths(TArray<FString> &Paths, bool IncludeMasterBank) const
@@ -1246,27 +1463,90 @@ void FFMODStudioModule::ShutdownModule()
     UE_LOG(LogFMOD, Verbose, TEXT("FFMODStudioModule finished unloading"));
 }
 
-struct NamedBankEntry
+bool FFMODStudioModule::AreBanksLoaded()
 {
-    NamedBankEntry()
-        : Bank(nullptr)
+    for (int i = 0; i < EFMODSystemContext::Max; ++i)
     {
+        if (bBankLoadPending[i])
+        {
+            return false;
+        }
     }
-    NamedBankEntry(const FString &InName, FMOD::Studio::Bank *InBank, FMOD_RESULT InResult)
-        : Name(InName)
-        , Bank(InBank)
-        , Result(InResult)
+    return bBanksLoaded;
+}
+
+void FFMODStudioModule::NotifyEventPlayed(const UFMODEvent *Event)
+{
+    if (SampleDataManager.IsEnabled() && IsValid(Event))
     {
+        SampleDataManager.Touch(Event->AssetGuid, GetEventDescription(Event, EFMODSystemContext::Runtime), Event->GetName());
     }
+}
 
-    FString Name;
-    FMOD::Studio::Bank *Bank;
-    FMOD_RESULT Result;
-};
+FMOD::Studio::EventInstance *FFMODStudioModule::AcquirePooledInstance(const UFMODEvent *Event)
+{
+    if (!InstancePool.IsEnabled() || !IsValid(Event))
+    {
+        return nullptr;
+    }
 
-bool FFMODStudioModule::AreBanksLoaded()
+    TSharedPtr<const FFMODEventMetadata> Metadata = GetEventMetadata(Event, EFMODSystemContext::Runtime);
+    if (!Metadata.IsValid())
+    {
+        return nullptr;
+    }
+
+    return InstancePool.Acquire(Event->AssetGuid, GetEventDescription(Event, EFMODSystemContext::Runtime), *Metadata);
+}
+
+bool FFMODStudioModule::RequestVoice(const UFMODEvent *Event, const FVector &Location, float MaxDistanceOverride)
 {
-    return bBanksLoaded;
+    if (!VoiceBudget.IsEnabled() || !IsValid(Event))
+    {
+        return true;
+    }
+
+    TSharedPtr<const FFMODEventMetadata> Metadata = GetEventMetadata(Event, EFMODSystemContext::Runtime);
+    if (!Metadata.IsValid())
+    {
+        return true;
+    }
+
+    const float ListenerDistance = FVector::Dist(GetNearestListener(Location).Transform.GetLocation(), Location);
+    return VoiceBudget.Admit(
+        Event->AssetGuid, GetEventDescription(Event, EFMODSystemContext::Runtime), *Metadata, ListenerDistance, MaxDistanceOverride);
+}
+
+void FFMODStudioModule::TrackVoice(const UFMODEvent *Event, FMOD::Studio::EventInstance *Instance)
+{
+    if (VoiceBudget.IsEnabled() && IsValid(Event))
+    {
+        VoiceBudget.Track(Event->AssetGuid, Instance);
+    }
+}
+
+FMOD::Studio::EventInstance *FFMODStudioModule::CoalesceOneshot(const UFMODEvent *Event, const FVector &Location)
+{
+    if (!OneshotCoalescer.IsEnabled() || !IsValid(Event))
+    {
+        return nullptr;
+    }
+
+    return OneshotCoalescer.Merge(Event->AssetGuid, GetEventDescription(Event, EFMODSystemContext::Runtime), Location);
+}
+
+void FFMODStudioModule::OpenCoalesceWindow(const UFMODEvent *Event, const FVector &Location, FMOD::Studio::EventInstance *Instance)
+{
+    if (!OneshotCoalescer.IsEnabled() || !IsValid(Event))
+    {
+        return;
+    }
+
+    TSharedPtr<const FFMODEventMetadata> Metadata = GetEventMetadata(Event, EFMODSystemContext::Runtime);
+    if (Metadata.IsValid())
+    {
+        OneshotCoalescer.Open(Event->AssetGuid, GetEventDescription(Event, EFMODSystemContext::Runtime), *Metadata, Location, Instance);
+    }
 }
 
 bool FFMODStudioModule::SetLocale(const FString& LocaleName)
@@ -1286,6 +1566,203 @@ bool FFMODStudioModule::SetLocale(const FString& LocaleName)
     return false;
 }
 
+bool FFMODStudioModule::SwitchLocale(const FString& LocaleName)
+{
+    const FString OldLocale = AssetTable.GetLocale();
+    if (!SetLocale(LocaleName))
+    {
+        return false;
+    }
+
+    const FString NewLocale = AssetTable.GetLocale();
+    FMOD::Studio::System *System = StudioSystem[EFMODSystemContext::Runtime];
+    if (!System || NewLocale == OldLocale)
+    {
+        return true;
+    }
+
+    TArray<FFMODLocalizedBankChange> Changes;
+    AssetTable.GetLocalizedBankChanges(OldLocale, NewLocale, Changes);
+
+    for (const FFMODLocalizedBankChange &Change : Changes)
+    {
+        // A bank still being swapped from an earlier switch is redirected to the latest locale
+        FLocaleBankSwap *Swap = LocaleBankSwaps.FindByPredicate([&Change](const FLocaleBankSwap &Existing) { return Existing.Guid == Change.Guid; });
+        if (Swap)
+        {
+            if (Swap->NewBank)
+            {
+                Swap->OldBank = Swap->NewBank;
+                Swap->NewBank = nullptr;
+            }
+            Swap->NewPath = Change.NewPath;
+            continue;
+        }
+
+        // Only banks that are loaded need swapping, the rest will load in the new locale when requested
+        FMOD::Studio::ID BankID = FMODUtils::ConvertGuid(Change.Guid);
+        FMOD::Studio::Bank *OldBank = nullptr;
+        if (System->getBankByID(&BankID, &OldBank) != FMOD_OK || !OldBank)
+        {
+            continue;
+        }
+
+        Swap = &LocaleBankSwaps.AddDefaulted_GetRef();
+        Swap->Guid = Change.Guid;
+        Swap->NewPath = Change.NewPath;
+        Swap->OldBank = OldBank;
+    }
+
+    UE_LOG(LogFMOD, Log, TEXT("Switching locale from '%s' to '%s', swapping %d localized banks"), *OldLocale, *NewLocale, LocaleBankSwaps.Num());
+    LocaleSwitchStartTime = FPlatformTime::Seconds();
+    UpdateLocaleSwitch();
+    return true;
+}
+
+static bool HasPlayingInstances(FMOD::Studio::Bank *Bank, bool bStop)
+{
+    int EventCount = 0;
+    if (Bank->getEventCount(&EventCount) != FMOD_OK || EventCount == 0)
+    {
+        return false;
+    }
+
+    TArray<FMOD::Studio::EventDescription *> Events;
+    Events.SetNumZeroed(EventCount);
+    verifyfmod(Bank->getEventList(Events.GetData(), EventCount, &EventCount));
+    Events.SetNum(EventCount);
+
+    bool bPlaying = false;
+    TArray<FMOD::Studio::EventInstance *> Instances;
+    for (FMOD::Studio::EventDescription *Event : Events)
+    {
+        int InstanceCount = 0;
+        if (Event->getInstanceCount(&InstanceCount) != FMOD_OK || InstanceCount == 0)
+        {
+            continue;
+        }
+
+        Instances.SetNumZeroed(InstanceCount);
+        verifyfmod(Event->getInstanceList(Instances.GetData(), InstanceCount, &InstanceCount));
+        for (int i = 0; i < InstanceCount; ++i)
+        {
+            FMOD_STUDIO_PLAYBACK_STATE State = FMOD_STUDIO_PLAYBACK_STOPPED;
+            if (Instances[i]->getPlaybackState(&State) == FMOD_OK && State != FMOD_STUDIO_PLAYBACK_STOPPED)
+            {
+                bPlaying = true;
+                if (bStop && State != FMOD_STUDIO_PLAYBACK_STOPPING)
+                {
+                    verifyfmod(Instances[i]->stop(FMOD_STUDIO_STOP_ALLOWFADEOUT));
+                }
+            }
+        }
+    }
+    return bPlaying;
+}
+
+static bool IsAnyBusPlaying(FMOD::Studio::System *System, const TArray<FString> &BusPaths, bool bStop)
+{
+    bool bPlaying = false;
+    for (const FString &BusPath : BusPaths)
+    {
+        FMOD::Studio::Bus *Bus = nullptr;
+        if (System->getBus(TCHAR_TO_UTF8(*BusPath), &Bus) != FMOD_OK || !Bus)
+        {
+            continue;
+        }
+
+        // The channel group only exists while something is routed through the bus
+        FMOD::ChannelGroup *ChannelGroup = nullptr;
+        bool bBusPlaying = false;
+        if (Bus->getChannelGroup(&ChannelGroup) == FMOD_OK && ChannelGroup && ChannelGroup->isPlaying(&bBusPlaying) == FMOD_OK && bBusPlaying)
+        {
+            bPlaying = true;
+            if (bStop)
+            {
+                verifyfmod(Bus->stopAllEvents(FMOD_STUDIO_STOP_ALLOWFADEOUT));
+            }
+        }
+    }
+    return bPlaying;
+}
+
+void FFMODStudioModule::UpdateLocaleSwitch()
+{
+    FMOD::Studio::System *System = StudioSystem[EFMODSystemContext::Runtime];
+    if (!System)
+    {
+        LocaleBankSwaps.Reset();
+        return;
+    }
+
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    const bool bTimedOut = (FPlatformTime::Seconds() - LocaleSwitchStartTime) > Settings.LocaleSwitchTimeout;
+
+    // Dialogue resolved from the localized audio tables can play from events outside the swapped banks
+    const bool bWaitBusPlaying = IsAnyBusPlaying(System, Settings.LocaleSwitchWaitBuses, bTimedOut);
+
+    for (int32 i = LocaleBankSwaps.Num() - 1; i >= 0; --i)
+    {
+        FLocaleBankSwap &Swap = LocaleBankSwaps[i];
+
+        if (Swap.OldBank)
+        {
+            if (Swap.OldBank->isValid())
+            {
+                // Let dialogue from the old locale finish, fading it out once the timeout has passed
+                if (HasPlayingInstances(Swap.OldBank, bTimedOut) || bWaitBusPlaying)
+                {
+                    continue;
+                }
+
+                FMOD_STUDIO_LOADING_STATE SampleState = FMOD_STUDIO_LOADING_STATE_UNLOADED;
+                Swap.OldBank->getSampleLoadingState(&SampleState);
+                Swap.bLoadSampleData = (SampleState == FMOD_STUDIO_LOADING_STATE_LOADING || SampleState == FMOD_STUDIO_LOADING_STATE_LOADED);
+
+                verifyfmod(Swap.OldBank->unload());
+            }
+            Swap.OldBank = nullptr;
+
+            if (Swap.NewPath.IsEmpty())
+            {
+                LocaleBankSwaps.RemoveAt(i);
+                continue;
+            }
+
+            // Localized banks share their ID across locales, so the new one can only load once the old one is gone
+            UE_LOG(LogFMOD, Log, TEXT("Loading localized bank: %s"), *Swap.NewPath);
+            FMOD_RESULT Result = LoadFMODBank(System, Swap.NewPath, FMOD_STUDIO_LOAD_BANK_NONBLOCKING, &Swap.NewBank);
+            if (Result != FMOD_OK)
+            {
+                UE_LOG(LogFMOD, Warning, TEXT("Failed to load bank: %s (%s)"), *Swap.NewPath, UTF8_TO_TCHAR(FMOD_ErrorString(Result)));
+                LocaleBankSwaps.RemoveAt(i);
+                continue;
+            }
+        }
+
+        FMOD_STUDIO_LOADING_STATE LoadingState = FMOD_STUDIO_LOADING_STATE_ERROR;
+        if (Swap.NewBank->getLoadingState(&LoadingState) == FMOD_OK && LoadingState == FMOD_STUDIO_LOADING_STATE_LOADING)
+        {
+            continue;
+        }
+
+        if (LoadingState == FMOD_STUDIO_LOADING_STATE_LOADED && Swap.bLoadSampleData)
+        {
+            verifyfmod(Swap.NewBank->loadSampleData());
+        }
+        else if (LoadingState != FMOD_STUDIO_LOADING_STATE_LOADED)
+        {
+            UE_LOG(LogFMOD, Warning, TEXT("Failed to load bank: %s"), *Swap.NewPath);
+        }
+        LocaleBankSwaps.RemoveAt(i);
+    }
+
+    if (LocaleBankSwaps.Num() == 0)
+    {
+        UE_LOG(LogFMOD, Log, TEXT("Finished switching locale to '%s'"), *AssetTable.GetLocale());
+    }
+}
+
 FString FFMODStudioModule::GetLocale()
 {
     return AssetTable.GetLocale();
@@ -1317,6 +1794,10 @@ void FFMODStudioModule::LoadBanks(EFMODSystemContext::Type Type)
     const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
 
     FailedBankLoads[Type].Reset();
+    PendingBankLoads[Type].Reset();
+    bBankLoadPending[Type] = false;
+    BumpFMODBankGeneration();
+    EventMetadata.Reset();
     if (Type == EFMODSystemContext::Auditioning || Type == EFMODSystemContext::Editor)
     {
         RequiredPlugins.Reset();
@@ -1349,18 +1830,15 @@ void FFMODStudioModule::LoadBanks(EFMODSystemContext::Type Type)
         {
             FString MasterBankPath = Settings.GetFullBankPath() / AssetTable.GetMasterBankPath();
             UE_LOG(LogFMOD, Verbose, TEXT("Loading master bank: %s"), *MasterBankPath);
-            Result = StudioSystem[Type]->loadBankFile(TCHAR_TO_UTF8(*MasterBankPath), BankFlags, &MasterBank);
-            BankEntries.Add(NamedBankEntry(MasterBankPath, MasterBank, Result));
+            Result = LoadNamedBank(StudioSystem[Type], MasterBankPath, BankFlags, BankEntries, &MasterBank);
         }
 
         if (Result == FMOD_OK && !AssetTable.GetMasterAssetsBankPath().IsEmpty())
         {
-            FMOD::Studio::Bank *MasterAssetsBank = nullptr;
             FString MasterAssetsBankPath = Settings.GetFullBankPath() / AssetTable.GetMasterAssetsBankPath();
-            if (FPaths::FileExists(MasterAssetsBankPath))
+            if (FMODBankExists(MasterAssetsBankPath))
             {
-                Result = StudioSystem[Type]->loadBankFile(TCHAR_TO_UTF8(*MasterAssetsBankPath), BankFlags, &MasterAssetsBank);
-                BankEntries.Add(NamedBankEntry(MasterAssetsBankPath, MasterAssetsBank, Result));
+                Result = LoadNamedBank(StudioSystem[Type], MasterAssetsBankPath, BankFlags, BankEntries);
             }
         }
 
@@ -1372,9 +1850,7 @@ void FFMODStudioModule::LoadBanks(EFMODSystemContext::Type Type)
             {
                 FString StringsBankPath = Settings.GetFullBankPath() / AssetTable.GetMasterStringsBankPath();
                 UE_LOG(LogFMOD, Verbose, TEXT("Loading strings bank: %s"), *StringsBankPath);
-                FMOD::Studio::Bank *StringsBank = nullptr;
-                Result = StudioSystem[Type]->loadBankFile(TCHAR_TO_UTF8(*StringsBankPath), BankFlags, &StringsBank);
-                BankEntries.Add(NamedBankEntry(StringsBankPath, StringsBank, Result));
+                Result = LoadNamedBank(StudioSystem[Type], StringsBankPath, BankFlags, BankEntries);
             }
 
             // Optionally load all banks in the directory
@@ -1392,9 +1868,7 @@ void FFMODStudioModule::LoadBanks(EFMODSystemContext::Type Type)
                     }
                     UE_LOG(LogFMOD, Log, TEXT("Loading bank: %s"), *OtherFile);
 
-                    FMOD::Studio::Bank *OtherBank;
-                    Result = StudioSystem[Type]->loadBankFile(TCHAR_TO_UTF8(*OtherFile), BankFlags, &OtherBank);
-                    BankEntries.Add(NamedBankEntry(OtherFile, OtherBank, Result));
+                    Result = LoadNamedBank(StudioSystem[Type], OtherFile, BankFlags, BankEntries);
                 }
             }
 
@@ -1418,43 +1892,140 @@ void FFMODStudioModule::LoadBanks(EFMODSystemContext::Type Type)
             }
         }
 
-        // Wait for all banks to load.
-        StudioSystem[Type]->flushCommands();
+        if (Type == EFMODSystemContext::Runtime && Settings.bLoadBanksAsync)
+        {
+            // Return straight away and let Tick poll the loading state
+            UE_LOG(LogFMOD, Verbose, TEXT("Loading %d banks asynchronously"), BankEntries.Num());
+            PendingBankLoads[Type] = MoveTemp(BankEntries);
+            bBankLoadPending[Type] = true;
+            return;
+        }
 
-        for (NamedBankEntry &Entry : BankEntries)
+        // Submit the queued loads, then wait for them to finish, noting when each one does so its timings and memory
+        // are its own rather than the whole batch's
+        StudioSystem[Type]->flushCommands();
+        bool bStillLoading = true;
+        while (bStillLoading)
         {
-            if (Entry.Result == FMOD_OK)
+            bStillLoading = false;
+            for (NamedBankEntry &Entry : BankEntries)
             {
-                FMOD_STUDIO_LOADING_STATE BankLoadingState = FMOD_STUDIO_LOADING_STATE_ERROR;
-                Entry.Result = Entry.Bank->getLoadingState(&BankLoadingState);
-                if (BankLoadingState == FMOD_STUDIO_LOADING_STATE_ERROR)
+                if (Entry.Result == FMOD_OK && !Entry.Timings.UpdateLoadingState(Entry.Bank))
                 {
-                    Entry.Bank->unload();
-                    Entry.Bank = nullptr;
+                    bStillLoading = true;
                 }
-                else if (bLoadSampleData)
+            }
+            if (bStillLoading)
+            {
+                FPlatformProcess::Sleep(0.001f);
+            }
+        }
+
+        FinishLoadBanks(Type, BankEntries);
+        return;
+    }
+
+    bBanksLoaded = true;
+    BanksLoadedEvent.Broadcast(Type);
+}
+
+void FFMODStudioModule::PollPendingBankLoads(EFMODSystemContext::Type Type)
+{
+    bool bStillLoading = false;
+    for (NamedBankEntry &Entry : PendingBankLoads[Type])
+    {
+        if (Entry.Result == FMOD_OK && Entry.Bank && !Entry.Timings.UpdateLoadingState(Entry.Bank))
+        {
+            bStillLoading = true;
+        }
+    }
+    if (bStillLoading)
+    {
+        return;
+    }
+
+    TArray<NamedBankEntry> BankEntries = MoveTemp(PendingBankLoads[Type]);
+    bBankLoadPending[Type] = false;
+    FinishLoadBanks(Type, BankEntries);
+}
+
+void FFMODStudioModule::CacheEventMetadata(FMOD::Studio::Bank *Bank)
+{
+    int EventCount = 0;
+    if (Bank->getEventCount(&EventCount) != FMOD_OK || EventCount <= 0)
+    {
+        return;
+    }
+
+    TArray<FMOD::Studio::EventDescription *> EventDescriptions;
+    EventDescriptions.SetNumUninitialized(EventCount);
+    verifyfmod(Bank->getEventList(EventDescriptions.GetData(), EventCount, &EventCount));
+
+    const uint32 Generation = GetFMODBankGeneration();
+    for (int i = 0; i < EventCount; i++)
+    {
+        FMOD::Studio::ID ID;
+        if (EventDescriptions[i]->getID(&ID) == FMOD_OK)
+        {
+            EventMetadata.Add(FMODUtils::ConvertGuid(ID), { FFMODEventMetadata::Create(EventDescriptions[i]), Generation });
+        }
+    }
+}
+
+void FFMODStudioModule::FinishLoadBanks(EFMODSystemContext::Type Type, TArray<NamedBankEntry> &BankEntries)
+{
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    bool bLoadSampleData = ((Type == EFMODSystemContext::Runtime) && Settings.bLoadAllSampleData);
+
+    for (NamedBankEntry &Entry : BankEntries)
+    {
+        if (Entry.Result == FMOD_OK)
+        {
+            FMOD_STUDIO_LOADING_STATE BankLoadingState = FMOD_STUDIO_LOADING_STATE_ERROR;
+            Entry.Result = Entry.Bank->getLoadingState(&BankLoadingState);
+            if (BankLoadingState == FMOD_STUDIO_LOADING_STATE_ERROR)
+            {
+                Entry.Bank->unload();
+                Entry.Bank = nullptr;
+            }
+            else
+            {
+                CacheEventMetadata(Entry.Bank);
+
+                if (bLoadSampleData)
                 {
                     verifyfmod(Entry.Bank->loadSampleData());
+                    Entry.Timings.BeginSampleData();
                 }
             }
-            if (Entry.Bank == nullptr || Entry.Result != FMOD_OK)
+        }
+        TrackFMODBankLoad(StudioSystem[Type], Entry.Name, Entry.Bank, Entry.Result, Entry.Timings);
+
+#if WITH_EDITOR
+        if (Type == EFMODSystemContext::Auditioning)
+        {
+            AuditioningBankFiles.Add(FPaths::ConvertRelativePathToFull(Entry.Name), Entry.Result == FMOD_OK ? Entry.Bank : nullptr);
+        }
+#endif
+        if (Entry.Bank == nullptr || Entry.Result != FMOD_OK)
+        {
+            FString ErrorMessage;
+            if (!FMODBankExists(Entry.Name))
             {
-                FString ErrorMessage;
-                if (!FPaths::FileExists(Entry.Name))
-                {
-                    ErrorMessage = "File does not exist";
-                }
-                else
-                {
-                    ErrorMessage = UTF8_TO_TCHAR(FMOD_ErrorString(Entry.Result));
-                }
-                UE_LOG(LogFMOD, Warning, TEXT("Failed to load bank: %s (%s)"), *Entry.Name, *ErrorMessage);
-                FailedBankLoads[Type].Add(FString::Printf(TEXT("%s (%s)"), *FPaths::GetBaseFilename(Entry.Name), *ErrorMessage));
+                ErrorMessage = "File does not exist";
+            }
+            else
+            {
+                ErrorMessage = UTF8_TO_TCHAR(FMOD_ErrorString(Entry.Result));
             }
+            UE_LOG(LogFMOD, Warning, TEXT("Failed to load bank: %s (%s)"), *Entry.Name, *ErrorMessage);
+            FailedBankLoads[Type].Add(FString::Printf(TEXT("%s (%s)"), *FPaths::GetBaseFilename(Entry.Name), *ErrorMessage));
         }
     }
 
+    UE_LOG(LogFMOD, Verbose, TEXT("Finished loading banks for context %s"), FMODSystemContextNames[Type]);
     bBanksLoaded = true;
+    BanksLoadedEvent.Broadcast(Type);
 }
 
 #if WITH_EDITOR
@@ -1471,6 +2042,74 @@ void FFMODStudioModule::ReloadBanks()
     LoadBanks(EFMODSystemContext::Auditioning);
     CreateStudioSystem(EFMODSystemContext::Editor);
 }
+
+bool FFMODStudioModule::ReloadChangedBanks(const TArray<FString> &ChangedFiles)
+{
+    const EFMODSystemContext::Type Type = EFMODSystemContext::Auditioning;
+    if (!StudioSystem[Type] || bBankLoadPending[Type])
+    {
+        return false;
+    }
+
+    // The master banks define the asset table and buses, so changes to them need everything reloaded
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    const FString BankPath = Settings.GetFullBankPath();
+    for (const FString &File : ChangedFiles)
+    {
+        const FString FullFile = FPaths::ConvertRelativePathToFull(File);
+        for (const FString &MasterFile : { AssetTable.GetMasterBankPath(), AssetTable.GetMasterAssetsBankPath(), AssetTable.GetMasterStringsBankPath() })
+        {
+            if (!MasterFile.IsEmpty() && FPaths::IsSamePath(FullFile, FPaths::ConvertRelativePathToFull(BankPath / MasterFile)))
+            {
+                return false;
+            }
+        }
+    }
+
+    // Banks that LoadBanks didn't try, such as other locales or skipped banks, are left alone. If none of the changes are
+    // to banks it tried, there is nothing to reload here, so let the caller do a full reload rather than report success.
+    const bool bAnyKnownBank = ChangedFiles.ContainsByPredicate(
+        [this](const FString &File) { return AuditioningBankFiles.Contains(FPaths::ConvertRelativePathToFull(File)); });
+    if (!bAnyKnownBank)
+    {
+        return false;
+    }
+
+    UE_LOG(LogFMOD, Verbose, TEXT("Reloading %d changed banks"), ChangedFiles.Num());
+
+    StopAuditioningInstance();
+    FailedBankLoads[Type].Reset();
+    EventMetadata.Reset();
+
+    // Banks in the editor system are loaded by editor world content rather than tracked here, so refresh it as a full reload does
+    if (StudioSystem[EFMODSystemContext::Editor])
+    {
+        CreateStudioSystem(EFMODSystemContext::Editor);
+    }
+
+    TArray<NamedBankEntry> BankEntries;
+    for (const FString &File : ChangedFiles)
+    {
+        FMOD::Studio::Bank *OldBank = nullptr;
+        if (!AuditioningBankFiles.RemoveAndCopyValue(FPaths::ConvertRelativePathToFull(File), OldBank))
+        {
+            continue;
+        }
+
+        // A bank that failed to load last time, such as a half written file, has nothing to unload and is retried
+        UE_LOG(LogFMOD, Log, TEXT("Reloading bank: %s"), *File);
+        if (OldBank)
+        {
+            verifyfmod(OldBank->unload());
+        }
+        LoadNamedBank(StudioSystem[Type], File, FMOD_STUDIO_LOAD_BANK_NONBLOCKING, BankEntries);
+    }
+
+    // Let Tick poll the loading state and broadcast when done
+    PendingBankLoads[Type] = MoveTemp(BankEntries);
+    bBankLoadPending[Type] = true;
+    return true;
+}
 #endif
 
 FMOD::Studio::System *FFMODStudioModule::GetStudioSystem(EFMODSystemContext::Type Context)
@@ -1490,14 +2129,60 @@ FMOD::Studio::EventDescription *FFMODStudioModule::GetEventDescription(const UFM
     }
     if (StudioSystem[Context] != nullptr && IsValid(Event) && Event->AssetGuid.IsValid())
     {
+        UFMODEvent::FCachedDescription &Cached = Event->CachedDescriptions[Context];
+        const uint32 Generation = GetFMODBankGeneration();
+
+        if (Cached.Generation == Generation)
+        {
+            return Cached.Description;
+        }
+
         FMOD::Studio::ID Guid = FMODUtils::ConvertGuid(Event->AssetGuid);
         FMOD::Studio::EventDescription *EventDesc = nullptr;
         StudioSystem[Context]->getEventByID(&Guid, &EventDesc);
+
+        // Misses aren't cached, the bank may still be loading
+        if (EventDesc)
+        {
+            Cached.Description = EventDesc;
+            Cached.Generation = Generation;
+        }
+
         return EventDesc;
     }
     return nullptr;
 }
 
+TSharedPtr<const FFMODEventMetadata> FFMODStudioModule::GetEventMetadata(const UFMODEvent *Event, EFMODSystemContext::Type Context)
+{
+    if (!IsValid(Event))
+    {
+        return nullptr;
+    }
+
+    // Records from before a bank was unloaded may describe an event that is gone or has been reloaded, so they are rebuilt
+    const uint32 Generation = GetFMODBankGeneration();
+    if (const FCachedEventMetadata *Cached = EventMetadata.Find(Event->AssetGuid))
+    {
+        if (Cached->Generation == Generation)
+        {
+            return Cached->Metadata;
+        }
+    }
+
+    // Banks loaded outside LoadBanks, such as through the bank manager, are cached on first use
+    FMOD::Studio::EventDescription *EventDesc = GetEventDescription(Event, Context);
+    if (!EventDesc)
+    {
+        EventMetadata.Remove(Event->AssetGuid);
+        return nullptr;
+    }
+
+    TSharedPtr<const FFMODEventMetadata> Metadata = FFMODEventMetadata::Create(EventDesc);
+    EventMetadata.Add(Event->AssetGuid, { Metadata, Generation });
+    return Metadata;
+}
+
 FMOD::Studio::EventInstance *FFMODStudioModule::CreateAuditioningInstance(const UFMODEvent *Event)
 {
     StopAuditioningInstance();
@@ -0,0 +1,213 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#include "FMODVoiceBudget.h"
+#include "FMODEventMetadata.h"
+#include "FMODSettings.h"
+#include "FMODUtils.h"
+#include "fmod_studio.hpp"
+#include "FMODStudioPrivatePCH.h"
+#include "CoreGlobals.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FMOD Voice Budget - Tracked Instances"), STAT_FMOD_VoiceBudget_Tracked, STATGROUP_FMOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD Voice Budget - Culled by Distance"), STAT_FMOD_VoiceBudget_CulledDistance, STATGROUP_FMOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD Voice Budget - Culled by Limit"), STAT_FMOD_VoiceBudget_CulledLimit, STATGROUP_FMOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FMOD Voice Budget - Stolen"), STAT_FMOD_VoiceBudget_Stolen, STATGROUP_FMOD);
+
+FFMODVoiceBudget::FFMODVoiceBudget()
+    : LastUpdateFrame(0)
+{
+}
+
+bool FFMODVoiceBudget::IsEnabled() const
+{
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    return Settings.bEnableVoiceBudget;
+}
+
+void FFMODVoiceBudget::Update()
+{
+    if (LastUpdateFrame == GFrameCounter)
+    {
+        return;
+    }
+    LastUpdateFrame = GFrameCounter;
+
+    for (int32 i = Voices.Num() - 1; i >= 0; --i)
+    {
+        const FVoice &Voice = Voices[i];
+
+        // The playback state doesn't show a start until Studio has processed it
+        if (GFrameCounter < Voice.StartFrame + 2)
+        {
+            continue;
+        }
+
+        FMOD_STUDIO_PLAYBACK_STATE State = FMOD_STUDIO_PLAYBACK_STOPPED;
+        if (!Voice.Instance->isValid() || Voice.Instance->getPlaybackState(&State) != FMOD_OK || State == FMOD_STUDIO_PLAYBACK_STOPPED)
+        {
+            Voices.RemoveAtSwap(i);
+            DEC_DWORD_STAT(STAT_FMOD_VoiceBudget_Tracked);
+        }
+    }
+}
+
+int32 FFMODVoiceBudget::FindCategory(const FGuid &Guid, FMOD::Studio::EventDescription *Description)
+{
+    if (const int32 *Category = EventCategories.Find(Guid))
+    {
+        return *Category;
+    }
+
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    int32 Category = INDEX_NONE;
+
+    if (Settings.VoiceCategories.Num() > 0)
+    {
+        const FString Path = FMODUtils::GetPath(Description);
+        int32 MatchLength = 0;
+
+        for (int32 i = 0; i < Settings.VoiceCategories.Num(); ++i)
+        {
+            const FString &Prefix = Settings.VoiceCategories[i].PathPrefix;
+            if (Prefix.Len() > MatchLength && Path.StartsWith(Prefix))
+            {
+                Category = i;
+                MatchLength = Prefix.Len();
+            }
+        }
+    }
+
+    EventCategories.Add(Guid, Category);
+    return Category;
+}
+
+int32 FFMODVoiceBudget::GetPriority(int32 Category) const
+{
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+    return Settings.VoiceCategories.IsValidIndex(Category) ? Settings.VoiceCategories[Category].Priority : 0;
+}
+
+bool FFMODVoiceBudget::MakeRoom(int32 MaxInstances, int32 Priority, TFunctionRef<bool(const FVoice &)> Filter)
+{
+    int32 Count = 0;
+    int32 Victim = INDEX_NONE;
+
+    for (int32 i = 0; i < Voices.Num(); ++i)
+    {
+        const FVoice &Voice = Voices[i];
+        if (!Filter(Voice))
+        {
+            continue;
+        }
+
+        ++Count;
+
+        if (!Voice.bOneshot)
+        {
+            continue;
+        }
+
+        // Lowest priority first, then oldest
+        if (Victim == INDEX_NONE || Voice.Priority < Voices[Victim].Priority ||
+            (Voice.Priority == Voices[Victim].Priority && Voice.StartTime < Voices[Victim].StartTime))
+        {
+            Victim = i;
+        }
+    }
+
+    if (Count < MaxInstances)
+    {
+        return true;
+    }
+
+    if (Count > MaxInstances || Victim == INDEX_NONE || Voices[Victim].Priority > Priority)
+    {
+        return false;
+    }
+
+    Voices[Victim].Instance->stop(FMOD_STUDIO_STOP_ALLOWFADEOUT);
+    Voices.RemoveAtSwap(Victim);
+    DEC_DWORD_STAT(STAT_FMOD_VoiceBudget_Tracked);
+    INC_DWORD_STAT(STAT_FMOD_VoiceBudget_Stolen);
+    return true;
+}
+
+bool FFMODVoiceBudget::Admit(const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FFMODEventMetadata &Metadata,
+    float ListenerDistance, float MaxDistanceOverride)
+{
+    if (!Description)
+    {
+        return true;
+    }
+
+    const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
+
+    if (Metadata.bIs3D)
+    {
+        const float MaxDistance = FMODUtils::DistanceToUEScale(MaxDistanceOverride >= 0.0f ? MaxDistanceOverride : Metadata.MaxDistance);
+        if (MaxDistance > 0.0f && ListenerDistance > MaxDistance + Settings.VoiceCullDistanceMargin)
+        {
+            INC_DWORD_STAT(STAT_FMOD_VoiceBudget_CulledDistance);
+            return false;
+        }
+    }
+
+    Update();
+
+    const int32 Category = FindCategory(Guid, Description);
+    const int32 Priority = GetPriority(Category);
+
+    if (Settings.MaxInstancesPerEvent > 0 &&
+        !MakeRoom(Settings.MaxInstancesPerEvent, Priority, [&Guid](const FVoice &Voice) { return Voice.Guid == Guid; }))
+    {
+        INC_DWORD_STAT(STAT_FMOD_VoiceBudget_CulledLimit);
+        return false;
+    }
+
+    if (Settings.VoiceCategories.IsValidIndex(Category) && Settings.VoiceCategories[Category].MaxInstances > 0 &&
+        !MakeRoom(Settings.VoiceCategories[Category].MaxInstances, Priority, [Category](const FVoice &Voice) { return Voice.Category == Category; }))
+    {
+        INC_DWORD_STAT(STAT_FMOD_VoiceBudget_CulledLimit);
+        return false;
+    }
+
+    return true;
+}
+
+void FFMODVoiceBudget::Track(const FGuid &Guid, FMOD::Studio::EventInstance *Instance)
+{
+    if (!Instance)
+    {
+        return;
+    }
+
+    // Pooled instances are reused, so an earlier play may still be tracked
+    FVoice *Voice = Voices.FindByPredicate([Instance](const FVoice &Existing) { return Existing.Instance == Instance; });
+    if (!Voice)
+    {
+        Voice = &Voices.AddDefaulted_GetRef();
+        INC_DWORD_STAT(STAT_FMOD_VoiceBudget_Tracked);
+    }
+
+    const int32 *Category = EventCategories.Find(Guid);
+    Voice->Instance = Instance;
+    Voice->Guid = Guid;
+    Voice->Category = Category ? *Category : INDEX_NONE;
+    Voice->Priority = GetPriority(Voice->Category);
+    Voice->StartFrame = GFrameCounter;
+    Voice->StartTime = FPlatformTime::Seconds();
+
+    FMOD::Studio::EventDescription *Description = nullptr;
+    bool bOneshot = true;
+    if (Instance->getDescription(&Description) == FMOD_OK && Description->isOneshot(&bOneshot) == FMOD_OK)
+    {
+        Voice->bOneshot = bOneshot;
+    }
+}
+
+void FFMODVoiceBudget::Reset()
+{
+    DEC_DWORD_STAT_BY(STAT_FMOD_VoiceBudget_Tracked, Voices.Num());
+    Voices.Reset();
+    EventCategories.Reset();
+}
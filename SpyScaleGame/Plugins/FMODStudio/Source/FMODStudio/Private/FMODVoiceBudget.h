@@ -0,0 +1,71 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace FMOD
+{
+namespace Studio
+{
+class EventDescription;
+class EventInstance;
+}
+}
+
+struct FFMODEventMetadata;
+
+/**
+ * Game side limits on event instances, checked before an instance is created so inaudible or excess plays never
+ * reach the mixer. Plays are culled beyond the event's max distance from the nearest listener, and limited per event
+ * and per voice category, stealing the oldest oneshot of equal or lower priority when a limit is reached.
+ * Looping instances count towards the limits but are never stolen, as nothing would restart them.
+ * Game thread only.
+ */
+class FFMODVoiceBudget
+{
+public:
+    FFMODVoiceBudget();
+
+    /** Whether bEnableVoiceBudget is set. When it is not, every play is admitted. */
+    bool IsEnabled() const;
+
+    /**
+     * Whether a play should create an instance. May stop an older instance to make room.
+     * @param ListenerDistance - Distance from the play to the nearest listener, in Unreal units
+     * @param MaxDistanceOverride - Max distance in FMOD units to cull against, or a negative value to use the event's
+     */
+    bool Admit(const FGuid &Guid, FMOD::Studio::EventDescription *Description, const FFMODEventMetadata &Metadata,
+        float ListenerDistance, float MaxDistanceOverride);
+
+    /** Count an instance created after Admit returned true against the limits until it stops. */
+    void Track(const FGuid &Guid, FMOD::Studio::EventInstance *Instance);
+
+    /** Stop counting instances that have stopped. Called from the module tick. */
+    void Update();
+
+    /** Forget all tracked instances, used when runtime banks are unloaded. */
+    void Reset();
+
+private:
+    struct FVoice
+    {
+        FMOD::Studio::EventInstance *Instance = nullptr;
+        FGuid Guid;
+        int32 Category = INDEX_NONE;
+        int32 Priority = 0;
+        uint64 StartFrame = 0;
+        double StartTime = 0.0;
+        bool bOneshot = true;
+    };
+
+    int32 FindCategory(const FGuid &Guid, FMOD::Studio::EventDescription *Description);
+    int32 GetPriority(int32 Category) const;
+
+    /** Make room under a limit of MaxInstances for voices matching Filter. Returns false if no oneshot can be stolen. */
+    bool MakeRoom(int32 MaxInstances, int32 Priority, TFunctionRef<bool(const FVoice &)> Filter);
+
+    TArray<FVoice> Voices;
+    TMap<FGuid, int32> EventCategories;
+    uint64 LastUpdateFrame;
+};
@@ -0,0 +1,66 @@
+// Copyright (c), Firelight Technologies Pty, Ltd. 2012-2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "fmod_studio_common.h"
+
+namespace FMOD
+{
+namespace Studio
+{
+class EventDescription;
+}
+}
+
+/** A parameter of an event, copied out of its FMOD_STUDIO_PARAMETER_DESCRIPTION */
+struct FFMODEventParameterInfo
+{
+    FName Name;
+    FMOD_STUDIO_PARAMETER_ID Id = {};
+    FMOD_STUDIO_PARAMETER_TYPE Type = FMOD_STUDIO_PARAMETER_GAME_CONTROLLED;
+    FMOD_STUDIO_PARAMETER_FLAGS Flags = 0;
+    float Minimum = 0.0f;
+    float Maximum = 0.0f;
+    float DefaultValue = 0.0f;
+
+    /** Set for the occlusion and ambient parameters named in the FMOD settings, which are driven by the integration */
+    bool bBuiltIn = false;
+};
+
+/**
+ * Properties of an event that don't change while its bank is loaded, gathered once so playing the event doesn't
+ * need to query the Studio API. Records are immutable and shared; get them from IFMODStudioModule::GetEventMetadata.
+ */
+struct FMODSTUDIO_API FFMODEventMetadata
+{
+    /** Build a record from a loaded event description */
+    static TSharedRef<const FFMODEventMetadata> Create(FMOD::Studio::EventDescription *Description);
+
+    /** Look up a parameter by name, or null if the event doesn't have it */
+    const FFMODEventParameterInfo *FindParameter(const FName &Name) const;
+
+    /** Length of the timeline in milliseconds, zero for events without one */
+    int32 Length = 0;
+    bool bIs3D = false;
+    bool bIsOneshot = false;
+    bool bIsStream = false;
+
+    /** Attenuation range in FMOD units */
+    float MinDistance = 0.0f;
+    float MaxDistance = 0.0f;
+
+    /** Parameters named in the FMOD settings, only valid when the matching bHas flag is set */
+    bool bHasOcclusionParameter = false;
+    bool bHasAmbientVolumeParameter = false;
+    bool bHasAmbientLPFParameter = false;
+    FMOD_STUDIO_PARAMETER_ID OcclusionParameterId = {};
+    FMOD_STUDIO_PARAMETER_ID AmbientVolumeParameterId = {};
+    FMOD_STUDIO_PARAMETER_ID AmbientLPFParameterId = {};
+
+    /** Every parameter of the event, in the order Studio reports them */
+    TArray<FFMODEventParameterInfo> Parameters;
+
+private:
+    TMap<FName, int32> ParameterIndices;
+};
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Modules/ModuleManager.h"
+#include "Templates/SharedPointer.h"
 
 namespace FMOD
 {
@@ -16,6 +17,7 @@ class EventInstance;
 
 class UFMODAsset;
 class UFMODBank;
+struct FFMODEventMetadata;
 class UFMODEvent;
 class UWorld;
 class AAudioVolume;
@@ -47,6 +49,12 @@ enum Type
 class IFMODStudioModule : public IModuleInterface
 {
 public:
+    /** Broadcast with the system context once every bank queued for it has finished loading, successfully or not */
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnBanksLoaded, EFMODSystemContext::Type);
+
+    /** Called with the resolved asset, or null if no asset has the requested name */
+    DECLARE_DELEGATE_OneParam(FOnFMODAssetFound, UFMODAsset *);
+
     /**
 	 * Singleton-like access to this module's interface.  This is just for convenience!
 	 * Beware of calling this during the shutdown phase, though.  Your module might have been unloaded already.
@@ -87,11 +95,33 @@ public:
 	 */
     virtual UFMODEvent *FindEventByName(const FString &Name) = 0;
 
+    /**
+	 * Look up an asset given its name, loading its package asynchronously if needed.
+	 * OnFound is called on the game thread, immediately if the asset is already loaded.
+	 */
+    virtual void FindAssetByNameAsync(const FString &Name, FOnFMODAssetFound OnFound) = 0;
+
     /**
       * Get the disk path for a Bank asset
       */
     virtual FString GetBankPath(const UFMODBank &Bank) = 0;
 
+    /**
+     * Add a reference to a runtime bank on behalf of UFMODBankManager, loading it asynchronously if needed.
+     * References are held by the module, so a bank released as one world ends stays loaded for BankUnloadGracePeriod.
+     * Returns false, without taking a reference, if the bank can't be loaded.
+     */
+    virtual bool AcquireManagedBank(const UFMODBank &Bank) = 0;
+
+    /** Remove a reference taken with AcquireManagedBank */
+    virtual void ReleaseManagedBank(const FGuid &BankGuid) = 0;
+
+    /** Number of references held through AcquireManagedBank */
+    virtual int32 GetManagedBankRefCount(const FGuid &BankGuid) = 0;
+
+    /** Whether a bank referenced through AcquireManagedBank has finished loading */
+    virtual bool IsManagedBankLoaded(const FGuid &BankGuid) = 0;
+
     /**
       * Get the disk paths for all Banks
       */
@@ -104,6 +134,14 @@ public:
     virtual FMOD::Studio::EventDescription *GetEventDescription(
         const UFMODEvent *Event, EFMODSystemContext::Type Context = EFMODSystemContext::Max) = 0;
 
+    /**
+	 * Get the cached length, flags, distances and parameters of an event.
+	 * Records are built when banks load, or on first use for banks loaded later, and rebuilt on first use after any bank
+	 * unloads. Returns null if the event isn't loaded.
+	 */
+    virtual TSharedPtr<const FFMODEventMetadata> GetEventMetadata(
+        const UFMODEvent *Event, EFMODSystemContext::Type Context = EFMODSystemContext::Max) = 0;
+
     /**
 	 * Create a single auditioning instance using the auditioning system
 	 */
@@ -152,12 +190,53 @@ public:
     /** Log a FMOD error */
     virtual void LogError(int result, const char *function) = 0;
 
-    /** Returns if the banks have been loaded */
+    /** Returns if the banks have been loaded, false while banks are still loading asynchronously */
     virtual bool AreBanksLoaded() = 0;
 
+    /** Event broadcast when bank loading for a system context completes */
+    virtual FOnBanksLoaded &OnBanksLoaded() = 0;
+
+    /** Mark an event as just played so the sample data residency manager keeps, or reloads, its sample data */
+    virtual void NotifyEventPlayed(const UFMODEvent *Event) = 0;
+
+    /**
+     * Get a reusable runtime instance of a oneshot event for fire-and-forget playback. Start it but don't release it;
+     * the pool restarts it once it has stopped. Returns null when pooling is disabled or the pool has no free instance.
+     */
+    virtual FMOD::Studio::EventInstance *AcquirePooledInstance(const UFMODEvent *Event) = 0;
+
+    /**
+     * Ask the voice budget whether a runtime play of an event at Location should create an instance.
+     * May stop an older oneshot instance to make room. Always true when the budget is disabled.
+     * MaxDistanceOverride, in FMOD units, replaces the event's max distance when it is not negative.
+     */
+    virtual bool RequestVoice(const UFMODEvent *Event, const FVector &Location, float MaxDistanceOverride = -1.0f) = 0;
+
+    /** Count an instance created for a play that RequestVoice admitted against the voice budget */
+    virtual void TrackVoice(const UFMODEvent *Event, FMOD::Studio::EventInstance *Instance) = 0;
+
+    /**
+     * Merge a fire-and-forget runtime play into an instance of the same event started nearby within its coalescing window.
+     * Returns the instance merged into, which must not be started or released, or null if the play needs its own instance.
+     */
+    virtual FMOD::Studio::EventInstance *CoalesceOneshot(const UFMODEvent *Event, const FVector &Location) = 0;
+
+    /** Open a coalescing window on an instance about to be started for a play that CoalesceOneshot didn't merge */
+    virtual void OpenCoalesceWindow(const UFMODEvent *Event, const FVector &Location, FMOD::Studio::EventInstance *Instance) = 0;
+
     /** Set active locale. Locale must be the locale name of one of the configured project locales */
     virtual bool SetLocale(const FString& Locale) = 0;
 
+    /**
+     * Set active locale and swap the loaded localized banks to the new locale, leaving non-localized banks loaded.
+     * Each old localized bank is unloaded once none of its events, nor anything on the LocaleSwitchWaitBuses, are playing,
+     * or after LocaleSwitchTimeout by stopping them, and the new locale's bank is then loaded in the background.
+     */
+    virtual bool SwitchLocale(const FString& Locale) = 0;
+
+    /** Whether banks are still being swapped by SwitchLocale */
+    virtual bool IsSwitchingLocale() = 0;
+
     /** Get active locale. */
     virtual FString GetLocale() = 0;
 
@@ -168,5 +247,12 @@ public:
 #if WITH_EDITOR
     /** Called by the editor module when banks have been modified on disk */
     virtual void ReloadBanks() = 0;
+
+    /**
+     * Unload and reload only the given bank files in the background. OnBanksLoaded is broadcast for the auditioning
+     * context once they have loaded. Returns false without doing anything if a full reload is needed instead, because
+     * the master, master assets or strings bank changed or a reload is already in progress.
+     */
+    virtual bool ReloadChangedBanks(const TArray<FString> &ChangedFiles) = 0;
 #endif
 };
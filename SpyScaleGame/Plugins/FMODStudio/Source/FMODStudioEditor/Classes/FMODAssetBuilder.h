@@ -44,6 +44,7 @@ private:
     void BuildBankLookup(const FString &AssetName, const FString &PackagePath, const UFMODSettings &InSettings, TArray<UObject*>& AssetsToSave);
     void BuildAssets(const UFMODSettings &InSettings, const FString &AssetLookupName, const FString &AssetLookupPath, TArray<UObject*>& AssetsToSave,
         TArray<UObject*>& AssetsToDelete);
+    void BuildAssetIndex(const UFMODSettings &InSettings, const FString &AssetLookupName, const FString &AssetLookupPath);
 
     FString GetAssetClassName(UClass *AssetClass);
     bool MakeAssetCreateInfo(const FGuid &AssetGuid, const FString &StudioPath, AssetCreateInfo *CreateInfo);
@@ -0,0 +1,21 @@
+// Copyright (c), Firelight Technologies Pty, Ltd.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "FMODPackBanksCommandlet.generated.h"
+
+/**
+ * Packs every bank in the platform bank directory into a single aligned container.
+ * Run as a cook step with -run=FMODPackBanks, then enable bUseBankContainer.
+ */
+UCLASS()
+class UFMODPackBanksCommandlet : public UCommandlet
+{
+    GENERATED_UCLASS_BODY()
+
+    //~ Begin UCommandlet Interface
+    virtual int32 Main(const FString &Params) override;
+    //~ End UCommandlet Interface
+};
@@ -1,6 +1,7 @@
 #include "FMODAssetBuilder.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "FMODAssetIndex.h"
 #include "FMODAssetLookup.h"
 #include "FMODAssetTable.h"
 #include "FMODBank.h"
@@ -17,7 +18,10 @@
 #include "ObjectTools.h"
 #include "SourceControlHelpers.h"
 #include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
 #include "Misc/MessageDialog.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
 
 #include "fmod_studio.hpp"
 
@@ -49,6 +53,7 @@ void FFMODAssetBuilder::ProcessBanks()
     FString PackagePath = Settings.GetFullContentPath() / FFMODAssetTable::PrivateDataPath();
     BuildBankLookup(FFMODAssetTable::BankLookupName(), PackagePath, Settings, AssetsToSave);
     BuildAssets(Settings, FFMODAssetTable::AssetLookupName(), PackagePath, AssetsToSave, AssetsToDelete);
+    BuildAssetIndex(Settings, FFMODAssetTable::AssetLookupName(), PackagePath);
     SaveAssets(AssetsToSave);
     DeleteAssets(AssetsToDelete);
 }
@@ -209,6 +214,65 @@ void FFMODAssetBuilder::BuildAssets(const UFMODSettings& InSettings, const FStri
     }
 }
 
+void FFMODAssetBuilder::BuildAssetIndex(const UFMODSettings &InSettings, const FString &AssetLookupName, const FString &AssetLookupPath)
+{
+    if (!BankLookup)
+    {
+        return;
+    }
+
+    // Both lookups have just been built, so their packages are already loaded
+    UPackage *AssetLookupPackage = FindPackage(nullptr, *(AssetLookupPath + AssetLookupName));
+    UDataTable *AssetLookup = AssetLookupPackage ? FindObject<UDataTable>(AssetLookupPackage, *AssetLookupName, true) : nullptr;
+
+    FFMODAssetIndex Index;
+    Index.Build(BankLookup, AssetLookup);
+
+    // Every platform's banks come from the same Studio project, so each platform directory gets the same index, fingerprinted
+    // with its own strings bank
+    TArray<FString> BankDirs;
+    BankDirs.Add(InSettings.GetFullBankPath());
+    if (InSettings.ForcePlatformName.IsEmpty())
+    {
+        FString BankRoot = InSettings.BankOutputDirectory.Path;
+        if (FPaths::IsRelative(BankRoot))
+        {
+            BankRoot = FPaths::ProjectContentDir() / BankRoot;
+        }
+
+        TArray<FString> PlatformDirs;
+        IFileManager::Get().FindFiles(PlatformDirs, *(BankRoot / TEXT("*")), false, true);
+        for (const FString &PlatformDir : PlatformDirs)
+        {
+            const FString BankDir = BankRoot / PlatformDir;
+            const bool bKnown = BankDirs.ContainsByPredicate([&BankDir](const FString &Dir) { return FPaths::IsSamePath(Dir, BankDir); });
+            if (!bKnown && IFileManager::Get().FileExists(*(BankDir / Index.MasterStringsBankPath)))
+            {
+                BankDirs.Add(BankDir);
+            }
+        }
+    }
+
+    for (const FString &BankDir : BankDirs)
+    {
+        Index.StringsBankHash = FMODAssetIndex::HashBankFile(BankDir / Index.MasterStringsBankPath);
+
+        TArray<uint8> Bytes;
+        FMemoryWriter Writer(Bytes);
+        Writer << Index;
+
+        FString IndexPath = BankDir / FMODAssetIndex::GetFilename();
+        if (FFileHelper::SaveArrayToFile(Bytes, *IndexPath))
+        {
+            UE_LOG(LogFMOD, Log, TEXT("Wrote asset index %s (%d banks, %d assets)"), *IndexPath, Index.Banks.Num(), Index.Assets.Num());
+        }
+        else
+        {
+            UE_LOG(LogFMOD, Warning, TEXT("Failed to write asset index %s"), *IndexPath);
+        }
+    }
+}
+
 void FFMODAssetBuilder::BuildBankLookup(const FString &AssetName, const FString &PackagePath, const UFMODSettings &InSettings,
     TArray<UObject*>& AssetsToSave)
 {
@@ -4,6 +4,7 @@
 #include "FMODAudioComponent.h"
 #include "FMODUtils.h"
 #include "FMODEvent.h"
+#include "FMODEventMetadata.h"
 #include "fmod_studio.hpp"
 #include "SceneView.h"
 #include "SceneManagement.h"
@@ -15,13 +16,11 @@ void FFMODAudioComponentVisualizer::DrawVisualization(const UActorComponent *Com
         const UFMODAudioComponent *AudioComp = Cast<const UFMODAudioComponent>(Component);
         if (IsValid(AudioComp) && AudioComp->Event)
         {
-            FMOD::Studio::EventDescription *EventDesc =
-                IFMODStudioModule::Get().GetEventDescription(AudioComp->Event, EFMODSystemContext::Auditioning);
-            if (EventDesc != nullptr)
+            TSharedPtr<const FFMODEventMetadata> Metadata =
+                IFMODStudioModule::Get().GetEventMetadata(AudioComp->Event, EFMODSystemContext::Auditioning);
+            if (Metadata.IsValid())
             {
-                bool bIs3D = false;
-                EventDesc->is3D(&bIs3D);
-                if (bIs3D)
+                if (Metadata->bIs3D)
                 {
                     const FColor AudioOuterRadiusColor(255, 153, 0);
                     const FColor AudioInnerRadiusColor(216, 130, 0);
@@ -37,7 +36,8 @@ void FFMODAudioComponentVisualizer::DrawVisualization(const UActorComponent *Com
                     }
                     else
                     {
-                        EventDesc->getMinMaxDistance(&MinDistance, &MaxDistance);
+                        MinDistance = Metadata->MinDistance;
+                        MaxDistance = Metadata->MaxDistance;
                     }
                     MinDistance = FMODUtils::DistanceToUEScale(MinDistance);
                     MaxDistance = FMODUtils::DistanceToUEScale(MaxDistance);
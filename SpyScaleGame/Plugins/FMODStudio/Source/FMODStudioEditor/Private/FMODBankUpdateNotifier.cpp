@@ -3,13 +3,14 @@
 #include "FMODBankUpdateNotifier.h"
 #include "FMODSettings.h"
 #include "HAL/FileManager.h"
+#include "Misc/Paths.h"
 
 #include "FMODStudioEditorPrivatePCH.h"
 
 FFMODBankUpdateNotifier::FFMODBankUpdateNotifier()
     : bUpdateEnabled(true)
     , NextRefreshTime(FDateTime::MinValue())
-    , FileTime(FDateTime::MinValue())
+    , bFilesAddedOrRemoved(false)
     , Countdown(0.0f)
 {
 }
@@ -18,7 +19,9 @@ void FFMODBankUpdateNotifier::SetFilePath(const FString &InPath)
 {
     FilePath = InPath;
     NextRefreshTime = FDateTime::MinValue();
-    FileTime = MostRecentFileTime();
+    FileTimes = GetFileTimes();
+    ModifiedFiles.Reset();
+    bFilesAddedOrRemoved = false;
 }
 
 void FFMODBankUpdateNotifier::Update(float DeltaTime)
@@ -40,6 +43,8 @@ void FFMODBankUpdateNotifier::Update(float DeltaTime)
             if (Countdown <= 0.0f)
             {
                 BanksUpdatedEvent.Broadcast();
+                ModifiedFiles.Reset();
+                bFilesAddedOrRemoved = false;
             }
         }
     }
@@ -56,6 +61,8 @@ void FFMODBankUpdateNotifier::EnableUpdate(bool bEnable)
 
         // Cancel any pending countdown
         Countdown = 0.0f;
+        ModifiedFiles.Reset();
+        bFilesAddedOrRemoved = false;
     }
 }
 
@@ -63,34 +70,51 @@ void FFMODBankUpdateNotifier::Refresh()
 {
     if (!FilePath.IsEmpty())
     {
-        FDateTime NewFileTime = MostRecentFileTime();
+        TMap<FString, FDateTime> NewFileTimes = GetFileTimes();
+        bool bChanged = false;
 
-        if (NewFileTime != FileTime)
+        for (const TPair<FString, FDateTime> &Pair : NewFileTimes)
+        {
+            const FDateTime *OldTime = FileTimes.Find(Pair.Key);
+            if (!OldTime)
+            {
+                bFilesAddedOrRemoved = true;
+                bChanged = true;
+            }
+            else if (*OldTime != Pair.Value)
+            {
+                ModifiedFiles.AddUnique(Pair.Key);
+                bChanged = true;
+            }
+        }
+
+        if (NewFileTimes.Num() != FileTimes.Num())
+        {
+            bFilesAddedOrRemoved = true;
+            bChanged = true;
+        }
+
+        if (bChanged)
         {
             const UFMODSettings &Settings = *GetDefault<UFMODSettings>();
             Countdown = (float)Settings.ReloadBanksDelay;
-            FileTime = NewFileTime;
+            FileTimes = MoveTemp(NewFileTimes);
         }
     }
 }
 
-FDateTime FFMODBankUpdateNotifier::MostRecentFileTime()
+TMap<FString, FDateTime> FFMODBankUpdateNotifier::GetFileTimes()
 {
-    // Get the most recent modified timestamp of all the bank files in the directory we are watching.
-    FDateTime MostRecent = FDateTime::MinValue();
+    // Get the modified timestamp of each bank file in the directory we are watching.
+    TMap<FString, FDateTime> Times;
 
     TArray<FString> BankPaths;
     IFileManager::Get().FindFilesRecursive(BankPaths, *FilePath, TEXT("*.bank"), true, false, false);
 
     for (const auto& Path : BankPaths)
     {
-        FDateTime ModifiedTime = IFileManager::Get().GetTimeStamp(*Path);
-
-        if (ModifiedTime > MostRecent)
-        {
-            MostRecent = ModifiedTime;
-        }
+        Times.Add(FPaths::ConvertRelativePathToFull(Path), IFileManager::Get().GetTimeStamp(*Path));
     }
 
-    return MostRecent;
+    return Times;
 }
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Containers/Map.h"
 #include "Containers/UnrealString.h"
 #include "Misc/DateTime.h"
 #include "Delegates/Delegate.h"
@@ -18,13 +19,21 @@ public:
 
     FSimpleMulticastDelegate BanksUpdatedEvent;
 
+    /** Bank files modified since the last BanksUpdatedEvent. Only valid while the event is being broadcast. */
+    const TArray<FString> &GetModifiedFiles() const { return ModifiedFiles; }
+
+    /** Whether bank files were added or removed since the last BanksUpdatedEvent. Only valid while the event is being broadcast. */
+    bool WereFilesAddedOrRemoved() const { return bFilesAddedOrRemoved; }
+
 private:
     void Refresh();
-    FDateTime MostRecentFileTime();
+    TMap<FString, FDateTime> GetFileTimes();
 
     bool bUpdateEnabled;
     FString FilePath;
     FDateTime NextRefreshTime;
-    FDateTime FileTime;
+    TMap<FString, FDateTime> FileTimes;
+    TArray<FString> ModifiedFiles;
+    bool bFilesAddedOrRemoved;
     float Countdown;
 };
@@ -0,0 +1,114 @@
+// Copyright (c), Firelight Technologies Pty, Ltd.
+
+#include "FMODPackBanksCommandlet.h"
+
+#include "FMODSettings.h"
+#include "FMODBankContainer.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFMODCommandlet, Log, All);
+
+static constexpr auto OutputParam = TEXT("output");
+
+UFMODPackBanksCommandlet::UFMODPackBanksCommandlet(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+}
+
+int32 UFMODPackBanksCommandlet::Main(const FString& CommandLine)
+{
+    const UFMODSettings& Settings = *GetDefault<UFMODSettings>();
+
+    TArray<FString> Tokens, Switches;
+    TMap<FString, FString> Params;
+    ParseCommandLine(*CommandLine, Tokens, Switches, Params);
+
+    FString BankDirectory = Settings.GetFullBankPath();
+    FString ContainerPath = BankDirectory / FMODBankContainer::GetFilename();
+    if (const FString *Output = Params.Find(OutputParam))
+    {
+        ContainerPath = *Output;
+    }
+
+    TArray<FString> BankFiles;
+    IFileManager::Get().FindFilesRecursive(BankFiles, *BankDirectory, TEXT("*.bank"), true, false);
+    BankFiles.Sort();
+
+    if (BankFiles.Num() == 0)
+    {
+        UE_LOG(LogFMODCommandlet, Error, TEXT("No banks found in '%s'."), *BankDirectory);
+        return 1;
+    }
+
+    FString BankPrefix = BankDirectory + TEXT("/");
+    FPaths::NormalizeFilename(BankPrefix);
+
+    FFMODBankContainerHeader Header;
+    for (const FString &BankFile : BankFiles)
+    {
+        FFMODBankContainerEntry &Entry = Header.Entries.AddDefaulted_GetRef();
+        Entry.Name = BankFile;
+        FPaths::NormalizeFilename(Entry.Name);
+        Entry.Name.RemoveFromStart(BankPrefix);
+        Entry.Size = IFileManager::Get().FileSize(*BankFile);
+    }
+
+    // Offsets are fixed width, so the index size is known before they are filled in
+    TArray<uint8> IndexBytes;
+    {
+        FMemoryWriter Measure(IndexBytes);
+        Measure << Header;
+    }
+
+    int64 Offset = Align((int64)IndexBytes.Num(), FMODBankContainer::Alignment);
+    for (FFMODBankContainerEntry &Entry : Header.Entries)
+    {
+        Entry.Offset = Offset;
+        Offset = Align(Offset + Entry.Size, FMODBankContainer::Alignment);
+    }
+
+    IndexBytes.Reset();
+    {
+        FMemoryWriter Writer(IndexBytes);
+        Writer << Header;
+    }
+
+    TUniquePtr<FArchive> Container(IFileManager::Get().CreateFileWriter(*ContainerPath));
+    if (!Container)
+    {
+        UE_LOG(LogFMODCommandlet, Error, TEXT("Unable to create '%s'."), *ContainerPath);
+        return 1;
+    }
+
+    Container->Serialize(IndexBytes.GetData(), IndexBytes.Num());
+
+    TArray<uint8> Padding;
+    Padding.SetNumZeroed(FMODBankContainer::Alignment);
+
+    for (int32 i = 0; i < Header.Entries.Num(); ++i)
+    {
+        const FFMODBankContainerEntry &Entry = Header.Entries[i];
+
+        Container->Serialize(Padding.GetData(), Entry.Offset - Container->Tell());
+
+        TArray<uint8> BankBytes;
+        if (!FFileHelper::LoadFileToArray(BankBytes, *BankFiles[i]) || BankBytes.Num() != Entry.Size)
+        {
+            UE_LOG(LogFMODCommandlet, Error, TEXT("Unable to read '%s'."), *BankFiles[i]);
+            Container->Close();
+            IFileManager::Get().Delete(*ContainerPath);
+            return 1;
+        }
+        Container->Serialize(BankBytes.GetData(), BankBytes.Num());
+
+        UE_LOG(LogFMODCommandlet, Display, TEXT("Packed %s (%lld bytes at offset %lld)"), *Entry.Name, Entry.Size, Entry.Offset);
+    }
+
+    Container->Close();
+    UE_LOG(LogFMODCommandlet, Display, TEXT("Wrote %d banks to '%s'."), Header.Entries.Num(), *ContainerPath);
+
+    return 0;
+}
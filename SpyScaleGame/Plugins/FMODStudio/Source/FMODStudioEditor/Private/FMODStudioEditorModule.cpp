@@ -178,6 +178,7 @@ public:
         : bSimulating(false)
         , bIsInPIE(false)
         , bRegisteredComponentVisualizers(false)
+        , bIncrementalReloadPending(false)
     {
     }
 
@@ -204,6 +205,10 @@ public:
     /** Build UE4 assets for FMOD Studio items */
     void ProcessBanks();
 
+    /** Reload just the banks that changed on disk, falling back to ProcessBanks when that is not possible */
+    void HandleBanksUpdated();
+    void HandleBanksLoaded(EFMODSystemContext::Type Context);
+
     /** Add extensions to menu */
     void RegisterHelpMenuEntries();
     void AddFileMenuExtension(FMenuBuilder &MenuBuilder);
@@ -225,6 +230,9 @@ public:
     /** Reload banks */
     void ReloadBanks();
 
+    /** Build the reload notification text from the auditioning bank load failures */
+    void GetBankLoadResult(FText &Message, SNotificationItem::ECompletionState &State);
+
     /** Callback for the main frame finishing load */
     void OnMainFrameLoaded(TSharedPtr<SWindow> InRootWindow, bool bIsNewProjectWindow);
 
@@ -273,9 +281,14 @@ public:
     /** Periodically checks for updates of the strings.bank file */
     FFMODBankUpdateNotifier BankUpdateNotifier;
 
+    /** Progress notification for a background reload of changed banks */
+    TWeakPtr<SNotificationItem> ReloadNotification;
+    FDelegateHandle BanksLoadedDelegateHandle;
+
     bool bSimulating;
     bool bIsInPIE;
     bool bRegisteredComponentVisualizers;
+    bool bIncrementalReloadPending;
 };
 
 IMPLEMENT_MODULE(FFMODStudioEditorModule, FMODStudioEditor)
@@ -371,7 +384,8 @@ void FFMODStudioEditorModule::OnPostEngineInit()
     }
 
     // Bind to bank update notifier to reload banks when they change on disk
-    BankUpdateNotifier.BanksUpdatedEvent.AddRaw(this, &FFMODStudioEditorModule::ProcessBanks);
+    BankUpdateNotifier.BanksUpdatedEvent.AddRaw(this, &FFMODStudioEditorModule::HandleBanksUpdated);
+    BanksLoadedDelegateHandle = IFMODStudioModule::Get().OnBanksLoaded().AddRaw(this, &FFMODStudioEditorModule::HandleBanksLoaded);
 
     // Register a callback to validate settings on startup
     IMainFrameModule& MainFrameModule = FModuleManager::LoadModuleChecked<IMainFrameModule>(TEXT("MainFrame"));
@@ -392,6 +406,76 @@ void FFMODStudioEditorModule::ProcessBanks()
     }
 }
 
+void FFMODStudioEditorModule::HandleBanksUpdated()
+{
+    if (IsRunningCommandlet() || !FApp::HasProjectName())
+    {
+        return;
+    }
+
+    // New or removed banks change the asset table, so they need the assets rebuilt as well
+    const TArray<FString> &ModifiedFiles = BankUpdateNotifier.GetModifiedFiles();
+    if (BankUpdateNotifier.WereFilesAddedOrRemoved() || !IFMODStudioModule::Get().ReloadChangedBanks(ModifiedFiles))
+    {
+        ProcessBanks();
+        return;
+    }
+
+    BankUpdateNotifier.EnableUpdate(false);
+    bIncrementalReloadPending = true;
+
+    if (TSharedPtr<SNotificationItem> OldNotification = ReloadNotification.Pin())
+    {
+        OldNotification->ExpireAndFadeout();
+    }
+
+    FNotificationInfo Info(FText::Format(LOCTEXT("FMODReloadingChangedBanks", "Reloading {0} changed FMOD {0}|plural(one=Bank,other=Banks)"),
+        FText::AsNumber(ModifiedFiles.Num())));
+    Info.Image = FAppStyle::GetBrush(TEXT("NoBrush"));
+    Info.FadeInDuration = 0.1f;
+    Info.FadeOutDuration = 0.5f;
+    Info.bUseThrobber = true;
+    Info.bUseSuccessFailIcons = true;
+    Info.bFireAndForget = false;
+    Info.bAllowThrottleWhenFrameRateIsLow = false;
+    ReloadNotification = FSlateNotificationManager::Get().AddNotification(Info);
+    if (TSharedPtr<SNotificationItem> NotificationItem = ReloadNotification.Pin())
+    {
+        NotificationItem->SetCompletionState(SNotificationItem::CS_Pending);
+    }
+}
+
+void FFMODStudioEditorModule::HandleBanksLoaded(EFMODSystemContext::Type Context)
+{
+    if (Context != EFMODSystemContext::Auditioning || !bIncrementalReloadPending)
+    {
+        return;
+    }
+
+    bIncrementalReloadPending = false;
+    BankUpdateNotifier.EnableUpdate(!bIsInPIE);
+    BanksReloadedDelegate.Broadcast();
+
+    FText Message;
+    SNotificationItem::ECompletionState State;
+    GetBankLoadResult(Message, State);
+
+    if (TSharedPtr<SNotificationItem> NotificationItem = ReloadNotification.Pin())
+    {
+        NotificationItem->SetText(Message);
+        NotificationItem->SetCompletionState(State);
+        NotificationItem->SetExpireDuration(State == SNotificationItem::CS_Fail ? 6.0f : 1.5f);
+        NotificationItem->ExpireAndFadeout();
+    }
+    ReloadNotification.Reset();
+
+    if (GCurrentLevelEditingViewportClient)
+    {
+        // Refresh any 3d event visualization
+        GCurrentLevelEditingViewportClient->bNeedsRedraw = true;
+    }
+}
+
 void FFMODStudioEditorModule::RegisterHelpMenuEntries()
 {
     FToolMenuOwnerScoped OwnerScoped(this);
@@ -1172,6 +1256,11 @@ void FFMODStudioEditorModule::ShutdownModule()
     {
         BankUpdateNotifier.BanksUpdatedEvent.RemoveAll(this);
 
+        if (IFMODStudioModule::IsAvailable())
+        {
+            IFMODStudioModule::Get().OnBanksLoaded().Remove(BanksLoadedDelegateHandle);
+        }
+
         // Unregister tick function.
         FTSTicker::GetCoreTicker().RemoveTicker(TickDelegateHandle);
 
@@ -1242,9 +1331,15 @@ void FFMODStudioEditorModule::ReloadBanks()
     BanksReloadedDelegate.Broadcast();
 
     // Show a reload notification
-    TArray<FString> FailedBanks = IFMODStudioModule::Get().GetFailedBankLoads(EFMODSystemContext::Auditioning);
     FText Message;
     SNotificationItem::ECompletionState State;
+    GetBankLoadResult(Message, State);
+    ShowNotification(Message, State);
+}
+
+void FFMODStudioEditorModule::GetBankLoadResult(FText &Message, SNotificationItem::ECompletionState &State)
+{
+    TArray<FString> FailedBanks = IFMODStudioModule::Get().GetFailedBankLoads(EFMODSystemContext::Auditioning);
     if (FailedBanks.Num() == 0)
     {
         Message = LOCTEXT("FMODBanksReloaded", "Reloaded FMOD Banks\n");
@@ -1264,7 +1359,6 @@ void FFMODStudioEditorModule::ReloadBanks()
         Message = FText::Format(LOCTEXT("FMODBanksReloaded", "{0}"), FText::FromString(CombinedMessage));
         State = SNotificationItem::CS_Fail;
     }
-    ShowNotification(Message, State);
 }
 
 void FFMODStudioEditorModule::ShowNotification(const FText &Text, SNotificationItem::ECompletionState State)